@@ -0,0 +1,206 @@
+/**
+ * @file bench_channel.cpp
+ * @author Niel Cansino (nielcansino@gmail.com)
+ * @brief Host benchmark: channel throughput and ISR-to-task latency
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ */
+
+#include <stdio.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "Scheduler.hpp"
+#include "Channel.hpp"
+
+/* Host threads stand in for the ISRs of the target */
+typedef std::chrono::steady_clock Clock;
+
+#define MESSAGES        (4000000UL)
+#define LATENCY_SAMPLES (2000U)
+#define ISR_PERIOD_US   (200U)
+#define TICK_PERIOD_US  (1000U)
+
+struct Message
+{
+    uint64_t seq;
+    int64_t stamp_ns;
+};
+
+static int64_t nowNs(void)
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        Clock::now().time_since_epoch()).count();
+}
+
+/**
+ * @brief Moves MESSAGES messages through an SPSC channel between two threads
+ */
+static void benchSpscThroughput(void)
+{
+    static SpscChannel<Message, 1024> ch;
+    const Clock::time_point start = Clock::now();
+
+    std::thread producer([]() {
+        for( uint64_t i = 0; i < MESSAGES; )
+        {
+            Message* m = ch.claim();
+            if( m == NULL ) { std::this_thread::yield(); continue; }
+            m->seq = i++;
+            ch.publish();
+        }
+    });
+
+    uint64_t expect = 0;
+    while( expect < MESSAGES )
+    {
+        Message* m = ch.peek();
+        if( m == NULL ) { std::this_thread::yield(); continue; }
+        if( m->seq != expect ) printf("  SPSC out of order at %llu\n", (unsigned long long)expect);
+        ++expect;
+        ch.release();
+    }
+    producer.join();
+
+    const double s = std::chrono::duration<double>(Clock::now() - start).count();
+    printf("spsc throughput:  %8.2f Mmsg/s\n", MESSAGES / s / 1e6);
+}
+
+/**
+ * @brief Moves MESSAGES messages from two producer threads through an MPSC channel
+ */
+static void benchMpscThroughput(void)
+{
+    static MpscChannel<Message, 1024> ch;
+    const Clock::time_point start = Clock::now();
+
+    auto produce = []() {
+        for( uint64_t i = 0; i < MESSAGES / 2; )
+        {
+            Message* m = ch.claim();
+            if( m == NULL ) { std::this_thread::yield(); continue; }
+            m->seq = i++;
+            ch.publish(m);
+        }
+    };
+    std::thread p1(produce);
+    std::thread p2(produce);
+
+    for( uint64_t got = 0; got < MESSAGES; )
+    {
+        if( ch.peek() == NULL ) { std::this_thread::yield(); continue; }
+        ++got;
+        ch.release();
+    }
+    p1.join();
+    p2.join();
+
+    const double s = std::chrono::duration<double>(Clock::now() - start).count();
+    printf("mpsc throughput:  %8.2f Mmsg/s (2 producers)\n", MESSAGES / s / 1e6);
+}
+
+/*
+ * ISR-to-task latency: a publisher thread stamps messages, the main loop
+ * runs the scheduler and the consumer task records how long each message
+ * waited in the channel.
+ */
+static SpscChannel<Message, 64>* g_isr_ch = NULL;
+static std::vector<int64_t> g_latency;
+
+static void consumerTask(void)
+{
+    Message* m;
+    while( ( m = g_isr_ch->peek() ) != NULL )
+    {
+        g_latency.push_back(nowNs() - m->stamp_ns);
+        g_isr_ch->release();
+    }
+}
+
+static void idleTask(void)
+{
+}
+
+static void benchLatency(const char* label, const uint32_t consumer_interval, const bool wake)
+{
+    Scheduler sch;
+    Scheduler::Task table[2] = {
+        {consumerTask, consumer_interval},
+        {idleTask, 1}
+    };
+    (void)sch.init(table, 2, TICK_PERIOD_US);
+
+    SpscChannel<Message, 64> ch;
+    if( wake ) ch.attach(sch, 0);
+    g_isr_ch = &ch;
+    g_latency.clear();
+    g_latency.reserve(LATENCY_SAMPLES);
+
+    std::atomic<bool> done(false);
+
+    std::thread systick([&]() {
+        while( !done.load() )
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(TICK_PERIOD_US));
+            (void)sch.tick();
+        }
+    });
+    std::thread isr([&]() {
+        for( uint32_t i = 0; i < LATENCY_SAMPLES; ++i )
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(ISR_PERIOD_US));
+            Message* m = ch.claim();
+            if( m == NULL ) continue;
+            m->seq = i;
+            m->stamp_ns = nowNs();
+            ch.publish();
+        }
+        done.store(true);
+    });
+
+    while( !done.load() || ch.count() != 0 )
+    {
+        sch.run();
+    }
+    isr.join();
+    systick.join();
+
+    std::sort(g_latency.begin(), g_latency.end());
+    const size_t n = g_latency.size();
+    printf("%-17s p50 %7.1f us  p99 %7.1f us  max %7.1f us  (%u samples)\n", label,
+           g_latency[n / 2] / 1e3, g_latency[n * 99 / 100] / 1e3, g_latency[n - 1] / 1e3,
+           (unsigned)n);
+}
+
+int main(void)
+{
+    benchSpscThroughput();
+    benchMpscThroughput();
+    benchLatency("latency polled:", 1, false);
+    benchLatency("latency woken:", Scheduler::EVENT_DRIVEN, true);
+    return 0;
+}
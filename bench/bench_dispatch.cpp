@@ -0,0 +1,219 @@
+/**
+ * @file bench_dispatch.cpp
+ * @author Niel Cansino (nielcansino@gmail.com)
+ * @brief Host benchmark: run() overhead with per-task, grouped and recorded due-checks
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ */
+
+#include <stdio.h>
+#include <chrono>
+
+#include "Scheduler.hpp"
+#include "Recorder.hpp"
+
+typedef std::chrono::steady_clock Clock;
+
+#define NUM_TASKS       (64U)
+#define PASSES          (2000000UL)
+#define RING_SIZE       (4096U)
+
+static volatile uint32_t g_sink;
+
+static void workTask(void)
+{
+    g_sink = g_sink + 1;
+}
+
+/**
+ * @brief   Builds a realistic table: mostly harmonic rates (1, 5, 10, 100 ticks)
+ *          plus a few non-harmonic ones that fall back to individual checks
+ */
+static void buildTable(Scheduler::Task* table)
+{
+    static const uint32_t rates[][2] = {
+        /* interval, number of tasks */
+        {1, 8}, {5, 16}, {10, 24}, {100, 12}, {7, 1}, {13, 1}, {33, 1}, {250, 1}
+    };
+
+    uint16_t n = 0;
+    for( size_t r = 0; r < sizeof(rates) / sizeof(rates[0]); ++r )
+    {
+        for( uint32_t k = 0; k < rates[r][1]; ++k )
+        {
+            table[n++] = Scheduler::Task(workTask, rates[r][0]);
+        }
+    }
+}
+
+/**
+ * @brief   Times [PASSES] passes of run(), with one tick every [passes_per_tick] passes.
+ *          When [rec] is given, its ring is drained after every pass.
+ */
+static double timePasses(Scheduler& sch, const uint32_t passes_per_tick, Recorder* const rec)
+{
+    static uint8_t sink[RING_SIZE];
+    const Clock::time_point start = Clock::now();
+
+    for( uint32_t p = 0; p < PASSES; ++p )
+    {
+        if( p % passes_per_tick == 0 ) (void)sch.tick();
+        sch.run();
+        if( rec != NULL ) (void)rec->drain(sink, RING_SIZE);
+    }
+
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count() / PASSES;
+}
+
+/**
+ * @brief   One 100 us task next to [NUM_TASKS - 1] tasks at 10 ms, for [PASSES]
+ *          passes of 100 us. With [multi_rate] false, a single 10 kHz tick
+ *          drives all tasks. Otherwise the slow tasks get a 100 Hz time base.
+ */
+static double timeMultiRate(const bool multi_rate)
+{
+    static Scheduler::Task fast_table[NUM_TASKS];
+    static Scheduler::Task slow_table[NUM_TASKS];
+    Scheduler fast;
+    Scheduler slow;
+    Scheduler::Extension fast_ext;
+    Scheduler::Extension slow_ext;
+
+    fast_table[0] = Scheduler::Task(workTask, 1);
+    for( uint16_t i = 1; i < NUM_TASKS; ++i )
+    {
+        fast_table[i] = Scheduler::Task(workTask, 100);
+        slow_table[i - 1] = Scheduler::Task(workTask, 1);
+    }
+
+    if( multi_rate )
+    {
+        (void)fast.init(fast_table, 1, 100U);
+        (void)slow.init(slow_table, NUM_TASKS - 1, 10000U);
+        (void)fast.extend(&fast_ext);
+        (void)slow.extend(&slow_ext);
+        (void)fast.attachTimeBase(&slow);
+    }
+    else
+    {
+        (void)fast.init(fast_table, NUM_TASKS, 100U);
+    }
+
+    const Clock::time_point start = Clock::now();
+
+    for( uint32_t p = 0; p < PASSES; ++p )
+    {
+        (void)fast.tick();
+        if( multi_rate && p % 100 == 0 ) (void)slow.tick();
+        fast.run();
+    }
+
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count() / PASSES;
+}
+
+/**
+ * @brief   [PASSES] passes of the 64-task table, one tick per pass, split into
+ *          two modes of half the tasks each. With [switch_every] non-zero,
+ *          the mode changes every [switch_every] passes.
+ */
+static double timeModes(const uint32_t switch_every)
+{
+    static Scheduler::Task table[NUM_TASKS];
+    static Scheduler::ModeEntry entries[2][NUM_TASKS / 2];
+    static Scheduler::Mode modes[2];
+    Scheduler sch;
+    Scheduler::Extension ext;
+
+    buildTable(table);
+    for( uint16_t i = 0; i < NUM_TASKS; ++i )
+    {
+        entries[i % 2][i / 2].task = i;
+        entries[i % 2][i / 2].interval = table[i].interval;
+    }
+    modes[0] = {"even", entries[0], NUM_TASKS / 2};
+    modes[1] = {"odd", entries[1], NUM_TASKS / 2};
+
+    (void)sch.init(table, NUM_TASKS, 1000U);
+    (void)sch.extend(&ext);
+    (void)sch.initModes(modes, 2);
+
+    const Clock::time_point start = Clock::now();
+
+    for( uint32_t p = 0; p < PASSES; ++p )
+    {
+        (void)sch.tick();
+        if( switch_every != 0 && p % switch_every == 0 ) (void)sch.requestMode(( p / switch_every ) % 2);
+        sch.run();
+    }
+
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count() / PASSES;
+}
+
+int main(void)
+{
+    static Scheduler::Task table[NUM_TASKS];
+    static Scheduler::PeriodClass classes[NUM_TASKS];
+    static uint16_t members[NUM_TASKS];
+    static uint8_t ring[RING_SIZE];
+    Recorder rec;
+    Scheduler sch;
+    Scheduler extended;
+    Scheduler::Extension ext;
+
+    const uint32_t passes_per_tick[] = {1, 10};
+
+    for( size_t k = 0; k < sizeof(passes_per_tick) / sizeof(passes_per_tick[0]); ++k )
+    {
+        buildTable(table);
+        (void)sch.init(table, NUM_TASKS, 1000U);
+        const double individual = timePasses(sch, passes_per_tick[k], NULL);
+
+        buildTable(table);
+        (void)extended.init(table, NUM_TASKS, 1000U);
+        (void)extended.extend(&ext);
+        (void)extended.group(classes, NUM_TASKS, members);
+        const double grouped = timePasses(extended, passes_per_tick[k], NULL);
+
+        buildTable(table);
+        (void)extended.init(table, NUM_TASKS, 1000U);
+        (void)rec.init(ring, RING_SIZE);
+        (void)extended.attachRecorder(&rec);
+        const double recorded = timePasses(extended, passes_per_tick[k], &rec);
+
+        printf("%u tasks, %2u pass(es)/tick: individual %7.1f ns/pass, grouped %7.1f ns/pass, recorded %7.1f ns/pass\n",
+               NUM_TASKS, passes_per_tick[k], individual, grouped, recorded);
+    }
+
+    const double single_rate = timeMultiRate(false);
+    const double multi_rate = timeMultiRate(true);
+    printf("1 task at 100 us + %u at 10 ms: single 10 kHz tick %7.1f ns/pass, 10 kHz + 100 Hz time bases %7.1f ns/pass\n",
+           NUM_TASKS - 1, single_rate, multi_rate);
+
+    const double steady = timeModes(0);
+    const double switching = timeModes(1);
+    printf("2 modes of %u tasks: no switch %7.1f ns/pass, switch every pass %7.1f ns/pass\n",
+           NUM_TASKS / 2, steady, switching);
+
+    return 0;
+}
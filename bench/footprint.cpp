@@ -0,0 +1,84 @@
+/**
+ * @file footprint.cpp
+ * @author Niel Cansino (nielcansino@gmail.com)
+ * @brief Footprint probe: one task table per tick width and table layout
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ */
+
+#include "Scheduler.hpp"
+
+/*
+ * Compiled once per configuration by the [footprint] target:
+ *  FOOTPRINT_TICK_TYPE     Width of the tick counter and intervals
+ *  FOOTPRINT_CONST_TABLE   1: const TaskDef table + TaskState in RAM
+ *                          0: Task table in RAM
+ */
+#ifndef FOOTPRINT_TICK_TYPE
+    #define FOOTPRINT_TICK_TYPE uint32_t
+#endif
+
+#ifndef FOOTPRINT_CONST_TABLE
+    #define FOOTPRINT_CONST_TABLE 0
+#endif
+
+typedef BasicScheduler<FOOTPRINT_TICK_TYPE> FootprintScheduler;
+
+static void footprintTask(void)
+{
+}
+
+/* 100 tasks per table */
+#define FP_TASK         {footprintTask, 10}
+#define FP_TASKS_10     FP_TASK, FP_TASK, FP_TASK, FP_TASK, FP_TASK, \
+                        FP_TASK, FP_TASK, FP_TASK, FP_TASK, FP_TASK
+#define FP_TASKS_100    FP_TASKS_10, FP_TASKS_10, FP_TASKS_10, FP_TASKS_10, FP_TASKS_10, \
+                        FP_TASKS_10, FP_TASKS_10, FP_TASKS_10, FP_TASKS_10, FP_TASKS_10
+#define FP_NUM_TASKS    (100)
+
+static FootprintScheduler footprint_scheduler;
+
+#if FOOTPRINT_CONST_TABLE
+static const FootprintScheduler::TaskDef footprint_defs[FP_NUM_TASKS] = { FP_TASKS_100 };
+static FootprintScheduler::TaskState footprint_states[FP_NUM_TASKS];
+#else
+static FootprintScheduler::Task footprint_table[FP_NUM_TASKS] = { FP_TASKS_100 };
+#endif
+
+/**
+ * @brief Entry point referenced by nothing; keeps the table and the scheduler alive
+ */
+void footprintLoop(void)
+{
+#if FOOTPRINT_CONST_TABLE
+    (void)footprint_scheduler.init(footprint_defs, footprint_states, FP_NUM_TASKS, 1000U);
+#else
+    (void)footprint_scheduler.init(footprint_table, FP_NUM_TASKS, 1000U);
+#endif
+
+    for( ;; )
+    {
+        footprint_scheduler.run();
+    }
+}
@@ -0,0 +1,66 @@
+/**
+ * @file footprint_sizeof.cpp
+ * @author Niel Cansino (nielcansino@gmail.com)
+ * @brief Prints the size of the scheduler records for each tick width
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ */
+
+#include <stdio.h>
+
+#include "Scheduler.hpp"
+
+#define REPORT_NUM_TASKS (100U)
+
+/**
+ * @brief Prints one line of the report for tick type [TickT]
+ */
+template <typename TickT>
+static void report(const char* name)
+{
+    typedef BasicScheduler<TickT> S;
+
+    printf("%-9s %9u %12u %14u %10u %10u %14u %16u\n", name,
+           (unsigned)sizeof(typename S::Task),
+           (unsigned)sizeof(typename S::TaskDef),
+           (unsigned)sizeof(typename S::TaskState),
+           (unsigned)sizeof(S),
+           (unsigned)sizeof(typename S::Extension),
+           (unsigned)( REPORT_NUM_TASKS * sizeof(typename S::Task) ),
+           (unsigned)( REPORT_NUM_TASKS * sizeof(typename S::TaskState) ));
+}
+
+int main(void)
+{
+    printf("%-9s %9s %12s %14s %10s %10s %14s %16s\n", "tick",
+           "Task", "TaskDef", "TaskState", "Scheduler", "Extension",
+           "RAM(ram)", "RAM(const)");
+    report<uint8_t>("uint8_t");
+    report<uint16_t>("uint16_t");
+    report<uint32_t>("uint32_t");
+    report<uint64_t>("uint64_t");
+    printf("Extension: only with group(), modes, statistics, recording, nesting or the governor\n");
+    printf("RAM columns: task table RAM for %u tasks in each layout\n", REPORT_NUM_TASKS);
+    return 0;
+}
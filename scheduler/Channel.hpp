@@ -0,0 +1,276 @@
+/**
+ * @file Channel.hpp
+ * @author Niel Cansino (nielcansino@gmail.com)
+ * @brief Statically sized, lock-free message channels between tasks and ISRs
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+
+#ifndef NULL
+    #define NULL (0)
+#endif
+
+/**
+ * ChannelWaker
+ * Wakes an event-driven consumer task when a message is published.
+ * Works with any scheduler type that provides notify(uint16_t).
+ */
+class ChannelWaker
+{
+public:
+    ChannelWaker() {}
+
+    /**
+     * @brief Binds the waker to a task of a scheduler
+     *
+     * @param sched      Scheduler that owns the consumer task
+     * @param task_index Index of the consumer task in the scheduler's table
+     */
+    template <typename S>
+    void bind(S& sched, const uint16_t task_index)
+    {
+        wake_ = &ChannelWaker::thunk<S>;
+        ctx_ = &sched;
+        task_index_ = task_index;
+    }
+
+    /* Wakes the bound task, if any */
+    void wake(void) const
+    {
+        if( wake_ != NULL ) (*wake_)(ctx_, task_index_);
+    }
+
+private:
+    template <typename S>
+    static void thunk(void* ctx, const uint16_t task_index)
+    {
+        (void)static_cast<S*>(ctx)->notify(task_index);
+    }
+
+    void (*wake_)(void*, const uint16_t) = NULL;
+    void* ctx_ = NULL;
+    uint16_t task_index_ = 0;
+};
+
+/**
+ * SpscChannel
+ * Single-producer single-consumer ring of N slots of type T.
+ * Slots are borrowed in place, so messages are written and read
+ * directly in the ring buffer without any copy.
+ *
+ * Producer:    T* m = ch.claim(); if( m ) { fill *m; ch.publish(); }
+ * Consumer:    T* m = ch.peek();  if( m ) { use *m;  ch.release(); }
+ */
+template <typename T, uint16_t N>
+class SpscChannel
+{
+    static_assert( N >= 2 && ( N & ( N - 1 ) ) == 0, "N must be a power of two" );
+    static_assert( N <= 0x8000U, "N must fit the 16-bit free-running indices" );
+
+public:
+    SpscChannel() {}
+
+    /**
+     * @brief Wakes [task_index] of [sched] on every publish()
+     */
+    template <typename S>
+    void attach(S& sched, const uint16_t task_index)
+    {
+        waker_.bind(sched, task_index);
+    }
+
+    /**
+     * @brief Borrows the next free slot for writing
+     *
+     * @return T*   Slot to fill in place, NULL when the channel is full
+     */
+    T* claim(void)
+    {
+        const uint16_t head = head_.load(std::memory_order_relaxed);
+        if( (uint16_t)( head - tail_.load(std::memory_order_acquire) ) >= N ) return NULL;
+
+        return &slots_[head & ( N - 1 )];
+    }
+
+    /**
+     * @brief Commits the slot returned by the last claim() and wakes the consumer
+     */
+    void publish(void)
+    {
+        head_.store( (uint16_t)( head_.load(std::memory_order_relaxed) + 1 ), std::memory_order_release );
+        waker_.wake();
+    }
+
+    /**
+     * @brief Borrows the oldest published slot for reading
+     *
+     * @return T*   Slot to read in place, NULL when the channel is empty
+     */
+    T* peek(void)
+    {
+        const uint16_t tail = tail_.load(std::memory_order_relaxed);
+        if( head_.load(std::memory_order_acquire) == tail ) return NULL;
+
+        return &slots_[tail & ( N - 1 )];
+    }
+
+    /**
+     * @brief Returns the slot returned by the last peek() to the producer
+     */
+    void release(void)
+    {
+        tail_.store( (uint16_t)( tail_.load(std::memory_order_relaxed) + 1 ), std::memory_order_release );
+    }
+
+    /* Number of published messages not yet released */
+    uint16_t count(void) const
+    {
+        return (uint16_t)( head_.load(std::memory_order_acquire) - tail_.load(std::memory_order_acquire) );
+    }
+
+private:
+    T slots_[N];
+    std::atomic<uint16_t> head_{0};     /*!< Free-running write index, owned by the producer */
+    std::atomic<uint16_t> tail_{0};     /*!< Free-running read index, owned by the consumer */
+    ChannelWaker waker_;
+};
+
+/**
+ * MpscChannel
+ * Multiple-producer single-consumer ring of N slots of type T.
+ * Producers (tasks or ISRs of any priority) claim slots with a single
+ * compare-and-swap and may publish them out of order; the consumer
+ * sees messages in claim order. A slot claimed but not yet published
+ * holds back the messages behind it, never the other producers.
+ *
+ * Producer:    T* m = ch.claim(); if( m ) { fill *m; ch.publish(m); }
+ * Consumer:    T* m = ch.peek();  if( m ) { use *m;  ch.release(); }
+ *
+ * Requires lock-free 32-bit compare-and-swap on the target.
+ */
+template <typename T, uint16_t N>
+class MpscChannel
+{
+    static_assert( N >= 2 && ( N & ( N - 1 ) ) == 0, "N must be a power of two" );
+
+public:
+    MpscChannel()
+    {
+        /* Slot i is free for the producer that claims position i */
+        for( uint32_t i = 0; i < N; ++i )
+        {
+            seq_[i].store(i, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Wakes [task_index] of [sched] on every publish()
+     */
+    template <typename S>
+    void attach(S& sched, const uint16_t task_index)
+    {
+        waker_.bind(sched, task_index);
+    }
+
+    /**
+     * @brief Borrows a free slot for writing
+     *
+     * @return T*   Slot to fill in place, NULL when the channel is full
+     */
+    T* claim(void)
+    {
+        uint32_t pos = head_.load(std::memory_order_relaxed);
+
+        for( ;; )
+        {
+            const uint32_t seq = seq_[pos & ( N - 1 )].load(std::memory_order_acquire);
+            const int32_t diff = (int32_t)( seq - pos );
+
+            if( diff == 0 )
+            {
+                /* Slot is free; race the other producers for it */
+                if( head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed) )
+                    return &slots_[pos & ( N - 1 )];
+            }
+            else if( diff < 0 )
+            {
+                /* Consumer has not released this slot yet */
+                return NULL;
+            }
+            else
+            {
+                /* Another producer took this position */
+                pos = head_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief Commits a slot returned by claim() and wakes the consumer
+     *
+     * @param slot  Pointer returned by claim()
+     */
+    void publish(T* const slot)
+    {
+        const uint32_t idx = (uint32_t)( slot - slots_ );
+        seq_[idx].store(seq_[idx].load(std::memory_order_relaxed) + 1, std::memory_order_release);
+        waker_.wake();
+    }
+
+    /**
+     * @brief Borrows the oldest published slot for reading
+     *
+     * @return T*   Slot to read in place, NULL when empty or when the
+     *              oldest claimed slot has not been published yet
+     */
+    T* peek(void)
+    {
+        const uint32_t idx = tail_ & ( N - 1 );
+        if( seq_[idx].load(std::memory_order_acquire) != tail_ + 1 ) return NULL;
+
+        return &slots_[idx];
+    }
+
+    /**
+     * @brief Returns the slot returned by the last peek() to the producers
+     */
+    void release(void)
+    {
+        seq_[tail_ & ( N - 1 )].store(tail_ + N, std::memory_order_release);
+        ++tail_;
+    }
+
+private:
+    T slots_[N];
+    std::atomic<uint32_t> seq_[N];      /*!< Per-slot sequence: pos when free, pos + 1 when published */
+    std::atomic<uint32_t> head_{0};     /*!< Next position to claim, shared by the producers */
+    uint32_t tail_ = 0;                 /*!< Next position to read, owned by the consumer */
+    ChannelWaker waker_;
+};
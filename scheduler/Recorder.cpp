@@ -0,0 +1,269 @@
+/**
+ * @file Recorder.cpp
+ * @author Niel Cansino (nielcansino@gmail.com)
+ * @brief Compact recorder of tick arrivals and dispatch decisions, with host replay
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ */
+
+#include "Recorder.hpp"
+
+/* Storage for the in-class constant, needed when it is odr-used */
+const uint8_t Recorder::MAX_RECORD_BYTES;
+
+/* Longest varint of a 64-bit value */
+#define VARINT_MAX_BYTES (10U)
+
+/**
+ * @brief Class constructor
+ * 
+ */
+Recorder::Recorder()
+{
+}
+
+/**
+ * @brief Destroy the Recorder object
+ * 
+ */
+Recorder::~Recorder()
+{
+}
+
+/**
+ * @brief   Prepares the recorder for recording into [buffer].
+ *          Attach it to a scheduler afterwards to start recording.
+ * 
+ * @param buffer    Ring storage
+ * @param size      Size of [buffer] in bytes; a power of two, at least MAX_RECORD_BYTES
+ * @return true     On successful initialization
+ * @return false    When [buffer] is null or [size] is invalid
+ */
+bool Recorder::init(uint8_t* const buffer, const uint32_t size)
+{
+    if( buffer == NULL ) return false;
+    if( size < MAX_RECORD_BYTES || ( size & ( size - 1 ) ) != 0 ) return false;
+
+    buffer_ = buffer;
+    size_ = size;
+    head_.store(0, std::memory_order_relaxed);
+    tail_.store(0, std::memory_order_relaxed);
+    overflowed_ = false;
+    replay_ = NULL;
+    start_tick_ = 0;
+
+    return true;
+}
+
+#if LEAN_SCHEDULER_REPLAY
+/**
+ * @brief   Loads a drained log for replay. Attach the recorder to a scheduler
+ *          initialized with the task table of the recording, then call replay().
+ * 
+ * @param log       Bytes returned by drain(), in order
+ * @param length    Number of bytes in [log]
+ * @return true     When [log] starts with a START record
+ * @return false    Otherwise
+ */
+bool Recorder::initReplay(const uint8_t* const log, const uint32_t length)
+{
+    uint8_t tag;
+    uint64_t value, extra;
+    uint32_t next;
+
+    if( log == NULL ) return false;
+
+    replay_ = log;
+    length_ = length;
+
+    if( !peek(0, tag, value, extra, next) || tag != TAG_CONTROL || value != 1 )
+    {
+        replay_ = NULL;
+        return false;
+    }
+
+    buffer_ = NULL;
+    start_tick_ = extra;
+    cursor_ = next;
+    diverged_ = false;
+    mismatches_ = 0;
+
+    return true;
+}
+#endif
+
+/**
+ * @brief   Moves recorded bytes out of the ring. Call from the consumer
+ *          (a task, or another core) often enough to keep the ring from filling.
+ * 
+ * @param out   Destination
+ * @param max   Capacity of [out]
+ * @return uint32_t Number of bytes copied
+ */
+uint32_t Recorder::drain(uint8_t* const out, const uint32_t max)
+{
+    if( buffer_ == NULL || out == NULL ) return 0;
+
+    const uint32_t tail = tail_.load(std::memory_order_relaxed);
+    uint32_t n = head_.load(std::memory_order_acquire) - tail;
+    if( n > max ) n = max;
+
+    for( uint32_t i = 0; i < n; ++i )
+    {
+        out[i] = buffer_[( tail + i ) & ( size_ - 1 )];
+    }
+
+    tail_.store(tail + n, std::memory_order_release);
+    return n;
+}
+
+/**
+ * @brief   Starts recording; called by the scheduler when the recorder is attached
+ * 
+ * @param tick  Tick counter of the scheduler
+ */
+void Recorder::begin(const uint64_t tick)
+{
+    if( replaying() ) return;
+
+    start_tick_ = tick;
+    emit(1, TAG_CONTROL, true, tick);
+}
+
+#if LEAN_SCHEDULER_REPLAY
+/**
+ * @brief   Decodes the varint at [pos] of the replayed log
+ * 
+ * @return false    When the log ends inside the varint
+ */
+bool Recorder::decode(uint32_t& pos, uint64_t& value) const
+{
+    value = 0;
+
+    for( uint8_t shift = 0; shift < 7 * VARINT_MAX_BYTES; shift += 7 )
+    {
+        if( pos >= length_ ) return false;
+
+        const uint8_t byte = replay_[pos++];
+        value |= (uint64_t)( byte & 0x7FU ) << shift;
+        if( ( byte & 0x80U ) == 0 ) return true;
+    }
+
+    return false;
+}
+
+/**
+ * @brief   Decodes the record at [pos] of the replayed log
+ * 
+ * @param pos   Offset of the record
+ * @param tag   Receives the record tag
+ * @param value Receives the value of the record
+ * @param extra Receives the second varint of TICK, START and MODE records
+ * @param next  Receives the offset of the following record
+ * @return false    At the end of the log
+ */
+bool Recorder::peek(uint32_t pos, uint8_t& tag, uint64_t& value, uint64_t& extra, uint32_t& next) const
+{
+    uint64_t header;
+
+    if( !decode(pos, header) ) return false;
+
+    tag = (uint8_t)( header & 3U );
+    value = header >> 2;
+    extra = 0;
+
+    if( tag == TAG_TICK || ( tag == TAG_CONTROL && ( value == 1 || value == 2 ) ) )
+    {
+        if( !decode(pos, extra) ) return false;
+    }
+
+    next = pos;
+    return true;
+}
+
+/**
+ * @brief   Ticks recorded right before read [position] of the current pass
+ * 
+ */
+uint64_t Recorder::replayTick(const uint16_t position)
+{
+    uint8_t tag;
+    uint64_t value, extra;
+    uint32_t next;
+
+    if( diverged_ ) return 0;
+    if( !peek(cursor_, tag, value, extra, next) ) return 0;
+    /* Positions are stored off by one, so PASS_START takes a single byte */
+    if( tag != TAG_TICK || extra != (uint16_t)( position + 1 ) ) return 0;
+
+    cursor_ = next;
+    return value;
+}
+
+/**
+ * @brief   Checks a decision of the replayed scheduler against the log
+ * 
+ */
+void Recorder::expect(const uint16_t task, const uint8_t tag)
+{
+    uint8_t rec_tag;
+    uint64_t value, extra;
+    uint32_t next;
+
+    if( diverged_ ) return;
+
+    /* Past the end of a log cut short by an overflow: nothing to compare */
+    if( !peek(cursor_, rec_tag, value, extra, next) ) return;
+
+    if( rec_tag == tag && value == task )
+    {
+        cursor_ = next;
+        return;
+    }
+
+    diverged_ = true;
+}
+
+/**
+ * @brief   Checks a mode switch of the replayed scheduler against the log
+ * 
+ */
+void Recorder::expectMode(const uint16_t mode)
+{
+    uint8_t tag;
+    uint64_t value, extra;
+    uint32_t next;
+
+    if( diverged_ ) return;
+    if( !peek(cursor_, tag, value, extra, next) ) return;
+
+    if( tag == TAG_CONTROL && value == 2 && extra == mode )
+    {
+        cursor_ = next;
+        return;
+    }
+
+    diverged_ = true;
+}
+#endif
@@ -0,0 +1,282 @@
+/**
+ * @file Recorder.hpp
+ * @author Niel Cansino (nielcansino@gmail.com)
+ * @brief Compact recorder of tick arrivals and dispatch decisions, with host replay
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+
+#ifndef NULL
+    #define NULL (0)
+#endif
+
+/*  Replay: initReplay(), nextPass() and replay(). Define it to 1 in the host
+ *  build that replays logs. The target only records; leaving it 0 keeps the
+ *  replay checks out of the scheduler hooks.
+ */
+#ifndef LEAN_SCHEDULER_REPLAY
+    #define LEAN_SCHEDULER_REPLAY 0
+#endif
+
+/**
+ * Recorder Class Declaration
+ * 
+ * Logs what run() saw and decided, so that a timing bug can be replayed:
+ *  - PASS      start of a run() pass
+ *  - START     tick counter when recording began
+ *  - TICK      tick counter found advanced by [delta] at read [position]
+ *              of the pass (PASS_START, then task index, or period class
+ *              index when grouped, PASS_END for the governor, then
+ *              num_tasks + k for the k-th child)
+ *  - WAKE      pending notify() of [task] consumed
+ *  - DISPATCH  [task] called, or num_tasks + k when the k-th child is released
+ *  - MODE      switched to [mode] at the start of the pass
+ * 
+ * Records are delta-encoded varints, so most take a single byte. They
+ * are written into a fixed byte ring that a consumer (e.g. a task
+ * streaming to a UART) empties through drain(). When the ring is full,
+ * recording stops for good and overflowed() is set: the log stays a
+ * replayable prefix instead of a log with holes.
+ * 
+ * On the host, built with LEAN_SCHEDULER_REPLAY 1, the drained bytes are
+ * loaded with initReplay() and replay() drives a freshly initialized
+ * scheduler, with the same task table, through the same passes, tick
+ * arrivals and wake-ups.
+ */
+class Recorder
+{
+public:
+
+    /* Record tags, in the two low bits of the first varint of a record */
+    enum Tag
+    {
+        TAG_DISPATCH = 0,
+        TAG_TICK = 1,
+        TAG_WAKE = 2,
+        TAG_CONTROL = 3     /*!< value 0: PASS, value 1: START followed by the start tick,
+                                 value 2: MODE followed by the mode index */
+    };
+
+    static const uint8_t MAX_RECORD_BYTES = 20;    /*!< Two 10-byte varints */
+
+    /* Constructor */
+    Recorder();
+    ~Recorder();
+
+    /**
+     * APIs
+     */
+    bool init(uint8_t* const buffer, const uint32_t size);
+    uint32_t drain(uint8_t* const out, const uint32_t max);
+    bool overflowed(void) const { return overflowed_; }
+    uint32_t mismatches(void) const { return mismatches_; }
+
+#if LEAN_SCHEDULER_REPLAY
+    bool initReplay(const uint8_t* const log, const uint32_t length);
+    bool replaying(void) const { return replay_ != NULL; }
+
+    /* Replay: prepares the next pass, returns false at the end of the log */
+    template <typename S>
+    bool nextPass(S& sched);
+#else
+    bool replaying(void) const { return false; }
+#endif
+
+    /**
+     * Scheduler hooks
+     */
+    static const uint16_t PASS_START = 0xFFFF;     // Read at the start of a pass
+    static const uint16_t PASS_END = 0xFFFE;       // Governor's read after the tasks
+
+    void begin(const uint64_t tick);
+    uint64_t startTick(void) const { return start_tick_; }
+
+    void pass(void)
+    {
+        if( !replaying() ) emit(0, TAG_CONTROL, false, 0);
+    }
+
+    /* Recording: [delta] new ticks found at read [position] of the pass */
+    void tickSeen(const uint16_t position, const uint64_t delta)
+    {
+        if( !replaying() ) emit(delta, TAG_TICK, true, (uint16_t)( position + 1 ));
+    }
+
+#if LEAN_SCHEDULER_REPLAY
+    /* Replay: ticks that arrived right before read [position] of the pass */
+    uint64_t ticksDue(const uint16_t position)
+    {
+        return replaying() ? replayTick(position) : 0;
+    }
+
+    void wake(const uint16_t task)
+    {
+        if( !replaying() ) emit(task, TAG_WAKE, false, 0);
+        else expect(task, TAG_WAKE);
+    }
+
+    void dispatched(const uint16_t task)
+    {
+        if( !replaying() ) emit(task, TAG_DISPATCH, false, 0);
+        else expect(task, TAG_DISPATCH);
+    }
+
+    void modeSwitched(const uint16_t mode)
+    {
+        if( !replaying() ) emit(2, TAG_CONTROL, true, mode);
+        else expectMode(mode);
+    }
+#else
+    uint64_t ticksDue(const uint16_t position) { (void)position; return 0; }
+    void wake(const uint16_t task) { emit(task, TAG_WAKE, false, 0); }
+    void dispatched(const uint16_t task) { emit(task, TAG_DISPATCH, false, 0); }
+    void modeSwitched(const uint16_t mode) { emit(2, TAG_CONTROL, true, mode); }
+#endif
+
+private:
+    /* Appends one record: varint(value << 2 | tag) [varint(extra)] */
+    void emit(const uint64_t value, const uint8_t tag, const bool has_extra, const uint64_t extra)
+    {
+        if( overflowed_ || buffer_ == NULL ) return;
+
+        uint32_t head = head_.load(std::memory_order_relaxed);
+        if( size_ - ( head - tail_.load(std::memory_order_acquire) ) < MAX_RECORD_BYTES )
+        {
+            overflowed_ = true;
+            return;
+        }
+
+        head = put(head, ( value << 2 ) | tag);
+        if( has_extra ) head = put(head, extra);
+
+        head_.store(head, std::memory_order_release);
+    }
+
+    uint32_t put(uint32_t head, uint64_t v)
+    {
+        while( v >= 0x80U )
+        {
+            buffer_[head++ & ( size_ - 1 )] = (uint8_t)( v | 0x80U );
+            v >>= 7;
+        }
+        buffer_[head++ & ( size_ - 1 )] = (uint8_t)v;
+        return head;
+    }
+
+#if LEAN_SCHEDULER_REPLAY
+    bool decode(uint32_t& pos, uint64_t& value) const;
+    bool peek(uint32_t pos, uint8_t& tag, uint64_t& value, uint64_t& extra, uint32_t& next) const;
+    uint64_t replayTick(const uint16_t position);
+    void expect(const uint16_t task, const uint8_t tag);
+    void expectMode(const uint16_t mode);
+#endif
+
+    /* Recording */
+    uint8_t* buffer_ = NULL;                /*!< Ring storage, [size_] bytes */
+    uint32_t size_ = 0;                     /*!< Power of two */
+    std::atomic<uint32_t> head_{0};         /*!< Free-running write index, owned by run() */
+    std::atomic<uint32_t> tail_{0};         /*!< Free-running read index, owned by drain() */
+    bool overflowed_ = false;               /*!< Set once the ring ran full; recording stopped */
+
+    /* Replay; kept in every build so the layout does not depend on LEAN_SCHEDULER_REPLAY */
+    const uint8_t* replay_ = NULL;          /*!< Drained log being replayed */
+    uint32_t length_ = 0;                   /*!< Bytes in [replay_] */
+    uint32_t cursor_ = 0;                   /*!< Next record to replay */
+    bool diverged_ = false;                 /*!< Current pass no longer follows the log */
+    uint32_t mismatches_ = 0;               /*!< Passes that did not follow the log */
+
+    uint64_t start_tick_ = 0;               /*!< Tick counter when recording began */
+
+};
+
+#if LEAN_SCHEDULER_REPLAY
+/**
+ * @brief   Prepares the next recorded pass: skips what is left of the current
+ *          one and replays the wake-ups consumed during the next one.
+ * 
+ * @param sched     Scheduler being replayed
+ * @return true     When [sched].run() should be called for the next pass
+ * @return false    At the end of the log
+ */
+template <typename S>
+bool Recorder::nextPass(S& sched)
+{
+    uint8_t tag;
+    uint64_t value, extra;
+    uint32_t next;
+
+    /* Find the next PASS record, counting leftovers of a diverged pass */
+    for( ;; )
+    {
+        if( !peek(cursor_, tag, value, extra, next) )
+        {
+            if( diverged_ ) ++mismatches_;
+            diverged_ = false;
+            return false;
+        }
+        cursor_ = next;
+        if( tag == TAG_CONTROL && value == 0 ) break;
+        diverged_ = true;
+    }
+    if( diverged_ ) ++mismatches_;
+    diverged_ = false;
+
+    /* Wake-ups and mode requests were pending before the pass started */
+    for( uint32_t pos = cursor_; peek(pos, tag, value, extra, next); pos = next )
+    {
+        if( tag == TAG_CONTROL && value == 2 )
+            (void)sched.requestMode((uint16_t)extra);
+        else if( tag == TAG_CONTROL )
+            break;
+        else if( tag == TAG_WAKE )
+            (void)sched.notify((uint16_t)value);
+    }
+
+    return true;
+}
+
+/**
+ * @brief   Replays a log through [sched], freshly initialized with the task table of the recording
+ * 
+ * @param sched     Scheduler to drive; the recorder must be attached to it
+ * @param log       Recorder loaded with initReplay()
+ * @return uint32_t Number of passes that did not follow the log
+ */
+template <typename S>
+uint32_t replay(S& sched, Recorder& log)
+{
+    while( log.nextPass(sched) )
+    {
+        sched.run();
+    }
+
+    return log.mismatches();
+}
+#endif
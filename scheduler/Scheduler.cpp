@@ -28,12 +28,23 @@
  */
 
 #include "Scheduler.hpp"
+#if LEAN_SCHEDULER_STATS
+#include "SchedulerStats.hpp"
+#endif
+#if LEAN_SCHEDULER_RECORDER
+#include "Recorder.hpp"
+#endif
+
+/* Storage for the in-class constant, needed when it is odr-used */
+template <typename TickT>
+const TickT BasicScheduler<TickT>::EVENT_DRIVEN;
 
 /**
  * @brief Class constructor
  * 
  */
-Scheduler::Scheduler(/* args */)
+template <typename TickT>
+BasicScheduler<TickT>::BasicScheduler(/* args */)
 {
 }
 
@@ -41,7 +52,8 @@ Scheduler::Scheduler(/* args */)
  * @brief Destroy the Scheduler:: Scheduler object
  * 
  */
-Scheduler::~Scheduler()
+template <typename TickT>
+BasicScheduler<TickT>::~BasicScheduler()
 {
 }
 
@@ -58,7 +70,8 @@ Scheduler::~Scheduler()
  * @return true     On successful initialization
  * @return false    Returns false when one of the functions in the [taskTable] is null.
  */
-bool Scheduler::init(Task* const taskTable, const uint16_t num_tasks, const uint32_t systick_interval)
+template <typename TickT>
+bool BasicScheduler<TickT>::init(Task* const taskTable, const uint16_t num_tasks, const uint32_t systick_interval)
 {
     bool retval = false;
 
@@ -73,79 +86,1296 @@ bool Scheduler::init(Task* const taskTable, const uint16_t num_tasks, const uint
     }
 
     /* Attaches the taskTable and num_tasks to internal variables */
+    detachFeatures();
+    systick_interval_ = systick_interval;
     task_table_ = taskTable;
+    task_defs_ = NULL;
+    task_states_ = NULL;
     num_tasks_ = num_tasks;
     
     /*  Initializes the last_called_ to 
-    *   (UINT32_MAX - interval + 1) so that function is called
+    *   (TickT max - interval + 1) so that function is called
     *   on first instance of run().
     */
+    continuous_ = false;
+    for( uint16_t i = 0; i < num_tasks; ++i )
+    {
+        task_table_[i].state_.last_called_ = (TickT)( 0 - task_table_[i].interval );
+        task_table_[i].state_.pending_ = 0;
+        if( task_table_[i].interval == 0 ) continuous_ = true;
+    }
+
+    /* Initialize system tick counter to zero; the first pass always scans */
+    sys_tick_ctr_ = 0;
+    scan_tick_ = (TickT)( 0 - 1 );
+    any_pending_ = 0;
+    started_ = false;
+
+    retval = true;
+    return retval;
+}
+
+/**
+ * @brief   Initializes the scheduler object with a split task table.
+ *          The immutable [taskDefs] can be a const table placed in flash;
+ *          only [taskStates] needs to be in RAM.
+ * 
+ * @param taskDefs   Array of type [TaskDef] with the functions and intervals
+ * @param taskStates Array of type [TaskState], one per member of [taskDefs]
+ * @param num_tasks  Number of members in arrays [taskDefs] and [taskStates]
+ * @param systick_interval  Actual duration of a single systick, in microseconds
+ * @return true     On successful initialization
+ * @return false    Returns false when an array is null or one of the functions is null.
+ */
+template <typename TickT>
+bool BasicScheduler<TickT>::init(const TaskDef* const taskDefs, TaskState* const taskStates, const uint16_t num_tasks, const uint32_t systick_interval)
+{
+    bool retval = false;
+
+    /* Checks for null pointer */
+    if( taskDefs == NULL || taskStates == NULL ) return retval; 
+
+    /* Checks whether the functions are not NULL */
+    for( uint16_t i = 0; i < num_tasks; ++i )
+    {
+        if( taskDefs[i].func == NULL ) 
+            return retval;
+    }
+
+    /* Attaches the tables and num_tasks to internal variables */
+    detachFeatures();
+    systick_interval_ = systick_interval;
+    task_table_ = NULL;
+    task_defs_ = taskDefs;
+    task_states_ = taskStates;
+    num_tasks_ = num_tasks;
+
+    /* Same first-run initialization as the RAM layout */
+    continuous_ = false;
     for( uint16_t i = 0; i < num_tasks; ++i )
     {
-        task_table_[i].last_called_ = UINT32_MAX - task_table_[i].interval + 1;
+        task_states_[i].last_called_ = (TickT)( 0 - task_defs_[i].interval );
+        task_states_[i].pending_ = 0;
+        if( task_defs_[i].interval == 0 ) continuous_ = true;
     }
 
-    /* Initialize system tick counter to zero */
+    /* Initialize system tick counter to zero; the first pass always scans */
     sys_tick_ctr_ = 0;
+    scan_tick_ = (TickT)( 0 - 1 );
+    any_pending_ = 0;
+    started_ = false;
 
     retval = true;
     return retval;
 }
 
+/**
+ * @brief   Provides the storage for the optional features: period classes,
+ *          statistics, recording, nested schedulers and time bases, modes
+ *          and the governor. Without it, group(), initModes() and the
+ *          attach functions return false, and the scheduler is as small
+ *          as one without these features. Call after init(); init() keeps
+ *          the extension but detaches the features.
+ * 
+ * @param ext       Extension, not used by another scheduler
+ * @return true     When extended
+ * @return false    When [ext] is NULL, or when this scheduler is nested in
+ *                  another one; the extension is then left as it is
+ */
+template <typename TickT>
+bool BasicScheduler<TickT>::extend(Extension* const ext)
+{
+    /* A nested scheduler keeps the links to its parent in its extension */
+    if( ext == NULL || ( ext_ != NULL && ext_->parent_ != NULL ) ) return false;
+
+    detachFeatures();
+    ext_ = ext;
+    detachFeatures();
+
+    return true;
+}
+
 /**
  * @brief Increments the system tick 
  * 
- * @return uint32_t 
+ * @return TickT 
  */
-uint32_t Scheduler::tick(void)
+template <typename TickT>
+TickT BasicScheduler<TickT>::tick(void)
 {
     return ++sys_tick_ctr_;
 }
 
+/**
+ * @brief   Reads the tick counter incremented by the tick() ISR.
+ *          A counter wider than LEAN_SCHEDULER_ATOMIC_BYTES takes several
+ *          loads, and tick() can fire between them; it is read again until
+ *          two reads agree, so a torn value is never used.
+ * 
+ * @return TickT Tick counter
+ */
+template <typename TickT>
+inline TickT BasicScheduler<TickT>::readTick(void) const
+{
+    TickT ctr = sys_tick_ctr_;
+
+    if( sizeof(TickT) > LEAN_SCHEDULER_ATOMIC_BYTES )
+    {
+        TickT again;
+        while( ( again = sys_tick_ctr_ ) != ctr ) ctr = again;
+    }
+
+    return ctr;
+}
+
 /**
  * @brief Get the system tick counter value
  * 
- * @return uint32_t System Tick Counter Value
+ * @return TickT System Tick Counter Value
+ */
+template <typename TickT>
+TickT BasicScheduler<TickT>::getTickCount(void)
+{
+    return readTick();
+}
+
+/**
+ * @brief   Wakes a task so that it runs on the next pass of run(),
+ *          regardless of its interval. Safe to call from an ISR.
+ *          The periodic phase of the task is not affected.
+ * 
+ * @param task_index Index of the task in the table passed to init()
+ * @return true     When the task was marked pending
+ * @return false    When task_index is out of range
  */
-uint32_t Scheduler::getTickCount(void)
+template <typename TickT>
+bool BasicScheduler<TickT>::notify(const uint16_t task_index)
 {
-    return sys_tick_ctr_;
+    if( task_index >= num_tasks_ ) return false;
+
+    /* Task flag first, so run() never sees the summary flag without it */
+    if( task_table_ != NULL ) 
+        task_table_[task_index].state_.pending_ = 1;
+    else
+        task_states_[task_index].pending_ = 1;
+    any_pending_ = 1;
+
+    return true;
+}
+
+/**
+ * @brief   Reads task [i] from whichever table layout was passed to init()
+ * 
+ * @param i         Index of the task
+ * @param func      Receives the task function
+ * @param interval  Receives the task interval
+ * @return TaskState* Run-time state of the task
+ */
+template <typename TickT>
+inline typename BasicScheduler<TickT>::TaskState* BasicScheduler<TickT>::fetch(const uint16_t i, void (*&func)(), TickT& interval) const
+{
+    TaskState* state;
+
+    if( task_table_ != NULL )
+    {
+        func = task_table_[i].func;
+        interval = task_table_[i].interval;
+        state = &task_table_[i].state_;
+    }
+    else
+    {
+        func = task_defs_[i].func;
+        interval = task_defs_[i].interval;
+        state = &task_states_[i];
+    }
+
+    /* A governed task runs at its effective interval */
+    if( ext_ != NULL && ext_->governor_ != NULL ) interval = ext_->governor_->effective_[i];
+
+    return state;
+}
+
+/**
+ * @brief   Reads the throttling limits of task [i] from [gov], resolving the defaults
+ * 
+ * @param gov           Governor holding the limits table
+ * @param i             Index of the task
+ * @param importance    Receives the importance
+ * @param min_interval  Receives the shortest allowed interval
+ * @param max_interval  Receives the longest allowed interval
+ */
+template <typename TickT>
+void BasicScheduler<TickT>::limits(const Governor* const gov, const uint16_t i, uint8_t& importance, TickT& min_interval, TickT& max_interval) const
+{
+    const TickT interval = ( task_table_ != NULL ) ? (TickT)task_table_[i].interval : task_defs_[i].interval;
+
+    importance = gov->limits_[i].importance;
+    min_interval = gov->limits_[i].min_interval;
+    max_interval = gov->limits_[i].max_interval;
+
+    if( min_interval == 0 ) min_interval = interval;
+    if( max_interval == 0 ) max_interval = interval;
+}
+
+/**
+ * @brief   Attaches a live statistics block, or detaches it when [stats] is NULL.
+ *          Attach after init() and extend(); init() detaches it.
+ * 
+ * @param stats     Statistics block, initialized with one TaskLoad per task
+ * @return true     When attached
+ * @return false    When detached, without an extension, or when built
+ *                  with LEAN_SCHEDULER_STATS 0
+ */
+template <typename TickT>
+bool BasicScheduler<TickT>::attachStats(SchedulerStats* const stats)
+{
+    if( ext_ == NULL ) return false;
+
+    ext_->stats_ = NULL;
+#if LEAN_SCHEDULER_STATS
+    if( stats == NULL ) return false;
+
+    stats->begin(systick_interval_);
+    ext_->stats_tick_ = readTick();
+    ext_->stats_ = stats;
+
+    return true;
+#else
+    (void)stats;
+    return false;
+#endif
+}
+
+/**
+ * @brief   Attaches a record/replay log, or detaches it when [recorder] is NULL.
+ *          Attach after init() and extend(), and before the first run();
+ *          init() detaches it.
+ *          The log holds the start tick but not the task phases, so a replay
+ *          can only start from the state left by init().
+ *          A recorder set up with init() logs every pass from now on.
+ *          A recorder set up with initReplay() takes over the tick counter:
+ *          ticks are then injected from the log, see replay().
+ * 
+ * @param recorder  Recorder prepared with init() or initReplay()
+ * @return true     When attached
+ * @return false    When detached, without an extension, when run() was
+ *                  called since init(), or when built with
+ *                  LEAN_SCHEDULER_RECORDER 0
+ */
+template <typename TickT>
+bool BasicScheduler<TickT>::attachRecorder(Recorder* const recorder)
+{
+    if( ext_ == NULL ) return false;
+
+    ext_->recorder_ = NULL;
+#if LEAN_SCHEDULER_RECORDER
+    if( recorder == NULL || started_ ) return false;
+
+    if( recorder->replaying() )
+        sys_tick_ctr_ = (TickT)recorder->startTick();
+
+    const TickT ctr = readTick();
+    if( !recorder->replaying() ) recorder->begin((uint64_t)ctr);
+
+    ext_->rec_tick_ = ctr;
+    ext_->recorder_ = recorder;
+
+    return true;
+#else
+    (void)recorder;
+    return false;
+#endif
+}
+
+/**
+ * @brief   Nests [child] as a subsystem released once every [divider] ticks
+ *          of this scheduler. The child is driven from run(); do not call
+ *          tick() or run() on it directly. Like a task, the child is first
+ *          released on the next pass. Children run after the own tasks,
+ *          in attach order, and a notify() on a child releases it on the
+ *          next pass of the parent. init() detaches all children.
+ *          With statistics attached, the time spent in the k-th child is
+ *          charged to task slot [num_tasks + k] of the SchedulerStats.
+ * 
+ * @param child     Initialized and extended scheduler, not attached anywhere else
+ * @param divider   Parent ticks per child tick, at least 1
+ * @return true     When attached
+ * @return false    On NULL, zero divider, already attached child, a cycle,
+ *                  or without an extension on either side
+ */
+template <typename TickT>
+bool BasicScheduler<TickT>::attachChild(BasicScheduler* const child, const TickT divider)
+{
+    if( divider == 0 ) return false;
+
+    return link(child, divider);
+}
+
+/**
+ * @brief   Adds [base] as an independent time base: a scheduler with its own
+ *          systick_interval, tick counter and tasks, whose tick() is called
+ *          from its own tick source. run() runs the tasks of a time base only
+ *          when its counter advanced since its last pass, or when one of its
+ *          tasks is notified or continuous, so a slow time base costs a single
+ *          check per pass. Time bases run after the own tasks, in attach order,
+ *          and roll up into the statistics like children. init() detaches them.
+ * 
+ * @param base      Initialized and extended scheduler, not attached anywhere else
+ * @return true     When attached
+ * @return false    On NULL, already attached [base], a cycle, or without an
+ *                  extension on either side
+ */
+template <typename TickT>
+bool BasicScheduler<TickT>::attachTimeBase(BasicScheduler* const base)
+{
+    return link(base, 0);
+}
+
+/**
+ * @brief   Appends [child] to the children, see attachChild() and attachTimeBase()
+ * 
+ * @param child     Scheduler to nest
+ * @param divider   Parent ticks per child tick, 0 for an independent time base
+ * @return true     When attached
+ * @return false    On NULL, already attached child, a cycle, or without an
+ *                  extension on either side
+ */
+template <typename TickT>
+bool BasicScheduler<TickT>::link(BasicScheduler* const child, const TickT divider)
+{
+    if( ext_ == NULL || child == NULL || child->ext_ == NULL || child->ext_->parent_ != NULL ) return false;
+
+    /* A scheduler cannot be its own ancestor */
+    for( const BasicScheduler* p = this; p != NULL; p = p->ext_->parent_ )
+    {
+        if( p == child ) return false;
+    }
+
+    Extension* const link = child->ext_;
+    link->divider_ = divider;
+    link->parent_last_ = (TickT)( readTick() - divider );
+    link->next_child_ = NULL;
+    link->parent_ = this;
+
+    /* Append, so children run in attach order */
+    BasicScheduler** tail = &ext_->children_;
+    while( *tail != NULL ) tail = &(*tail)->ext_->next_child_;
+    *tail = child;
+
+    return true;
+}
+
+/**
+ * @brief   Prepares a governor with the limits of the tasks and storage for
+ *          the effective intervals.
+ *          A tick counts as overloaded when a task was dispatched more than
+ *          [late_limit] ticks late, and as calm when no task was late and no
+ *          pass spanned a tick boundary. Anything in between resets both
+ *          counts, which keeps the governor from oscillating.
+ * 
+ * @param limits        Array of [num_tasks] throttling ranges, one per task
+ * @param effective     Array of [num_tasks] effective intervals
+ * @param num_tasks     Number of members in [limits] and [effective]
+ * @param late_limit    Tolerated lateness, in ticks
+ * @param stretch_after Overloaded ticks in a row before stretching one importance level
+ * @param restore_after Calm ticks in a row before restoring one importance level
+ * @return true     On success
+ * @return false    When an array is NULL or a count is zero
+ */
+template <typename TickT>
+bool BasicScheduler<TickT>::Governor::init(const Limits* const limits, TickT* const effective, const uint16_t num_tasks,
+                                           const TickT late_limit, const uint16_t stretch_after, const uint16_t restore_after)
+{
+    if( limits == NULL || effective == NULL || stretch_after == 0 || restore_after == 0 ) return false;
+
+    limits_ = limits;
+    effective_ = effective;
+    num_tasks_ = num_tasks;
+    late_limit_ = late_limit;
+    stretch_after_ = stretch_after;
+    restore_after_ = restore_after;
+
+    return true;
+}
+
+/**
+ * @brief   Attaches an interval governor, or detaches it when [governor] is NULL.
+ *          Attach after init() and extend(); init() detaches it. Tasks start
+ *          at their nominal interval, and only tasks whose
+ *          [min_interval, max_interval] range is wider than their interval
+ *          are ever changed.
+ *          A governed scheduler cannot be grouped or use modes.
+ * 
+ * @param governor  Governor prepared with init(), one effective interval per task
+ * @return true     When attached
+ * @return false    When detached, without an extension, on a grouped scheduler or one
+ *                  with modes, a short governor, or a task whose interval is outside its range
+ */
+template <typename TickT>
+bool BasicScheduler<TickT>::attachGovernor(Governor* const governor)
+{
+    void (*func)();
+    TickT interval;
+    uint8_t importance;
+    TickT min_interval;
+    TickT max_interval;
+
+    if( ext_ == NULL ) return false;
+
+    ext_->governor_ = NULL;
+    if( governor == NULL || ext_->classes_ != NULL || ext_->modes_ != NULL || governor->num_tasks_ < num_tasks_ ) return false;
+
+    for( uint16_t i = 0; i < num_tasks_; ++i )
+    {
+        (void)fetch(i, func, interval);
+        limits(governor, i, importance, min_interval, max_interval);
+        if( min_interval > interval || interval > max_interval ) return false;
+
+        governor->effective_[i] = interval;
+    }
+
+    governor->overloaded_ = 0;
+    governor->calm_ = 0;
+    governor->worst_late_ = 0;
+    governor->busy_ = false;
+    governor->last_tick_ = readTick();
+    ext_->governor_ = governor;
+
+    return true;
+}
+
+/**
+ * @brief   Sets up operating modes and enters mode 0 right away.
+ *          Each mode runs only the tasks of its dispatch table, at the
+ *          intervals given there. Task states are shared by all modes, so
+ *          a task keeps its phase across switches and is released when its
+ *          interval has elapsed since it last ran, in whichever mode.
+ *          Before the first run(), the tasks are released from the mode
+ *          intervals, so every periodic task is due on the first pass.
+ *          Call after init() and extend(); init() leaves modes. A scheduler
+ *          with modes cannot be grouped or governed.
+ * 
+ * @param modes     Array of [num_modes] modes, e.g. a const table
+ * @param num_modes Number of members in [modes]
+ * @return true     On success
+ * @return false    On a NULL or empty array, a NULL dispatch table, a task index
+ *                  out of range, a grouped or governed scheduler, or without an extension
+ */
+template <typename TickT>
+bool BasicScheduler<TickT>::initModes(const Mode* const modes, const uint16_t num_modes)
+{
+    bool continuous = false;
+
+    if( ext_ == NULL || modes == NULL || num_modes == 0 || ext_->classes_ != NULL || ext_->governor_ != NULL ) return false;
+
+    for( uint16_t m = 0; m < num_modes; ++m )
+    {
+        if( modes[m].entries == NULL && modes[m].num_entries != 0 ) return false;
+
+        for( uint16_t k = 0; k < modes[m].num_entries; ++k )
+        {
+            if( modes[m].entries[k].task >= num_tasks_ ) return false;
+            if( modes[m].entries[k].interval == 0 ) continuous = true;
+        }
+    }
+
+    /* Continuous tasks of any mode keep every pass scanning */
+    if( continuous ) continuous_ = true;
+
+    /*  init() released the tasks from the table intervals, which the
+     *  modes replace: move the first release back to the longest
+     *  interval a task has in any mode.
+     */
+    if( !started_ )
+    {
+        const TickT ctr = readTick();
+        void (*func)();
+        TickT interval;
+
+        for( uint16_t m = 0; m < num_modes; ++m )
+        {
+            for( uint16_t k = 0; k < modes[m].num_entries; ++k )
+            {
+                const TickT period = modes[m].entries[k].interval;
+                if( period == EVENT_DRIVEN ) continue;
+
+                TaskState* const state = fetch(modes[m].entries[k].task, func, interval);
+                if( (TickT)( ctr - state->last_called_ ) < period )
+                    state->last_called_ = (TickT)( ctr - period );
+            }
+        }
+    }
+
+    ext_->modes_ = modes;
+    ext_->num_modes_ = num_modes;
+    ext_->mode_index_ = 0;
+    ext_->requested_mode_ = 0;
+    ext_->mode_ = &modes[0];
+
+    return true;
+}
+
+/**
+ * @brief   Requests a switch to mode [mode_index]. The switch happens at the
+ *          start of the next pass of run(), never in the middle of one, and
+ *          costs O(1). Safe to call from an ISR, e.g. the tick ISR to switch
+ *          on a tick boundary.
+ * 
+ * @param mode_index    Index in the array passed to initModes()
+ * @return true     When requested
+ * @return false    When mode_index is out of range or modes are not used
+ */
+template <typename TickT>
+bool BasicScheduler<TickT>::requestMode(const uint16_t mode_index)
+{
+    if( ext_ == NULL || ext_->modes_ == NULL || mode_index >= ext_->num_modes_ ) return false;
+
+    ext_->requested_mode_ = mode_index;
+    return true;
+}
+
+/**
+ * @brief   Index of the active mode; 0 when modes are not used
+ * 
+ * @return uint16_t Index in the array passed to initModes()
+ */
+template <typename TickT>
+uint16_t BasicScheduler<TickT>::currentMode(void) const
+{
+    return ( ext_ != NULL ) ? ext_->mode_index_ : 0;
+}
+
+/**
+ * @brief   Interval task [task_index] currently runs at: its nominal interval,
+ *          the one set by the governor, or the one of the active mode
+ * 
+ * @param task_index Index of the task in the table passed to init()
+ * @return TickT    Effective interval, 0 when task_index is out of range,
+ *                  EVENT_DRIVEN when the active mode does not list the task
+ */
+template <typename TickT>
+TickT BasicScheduler<TickT>::effectiveInterval(const uint16_t task_index) const
+{
+    void (*func)();
+    TickT interval = 0;
+
+    if( task_index >= num_tasks_ ) return 0;
+
+    const Mode* const mode = ( ext_ != NULL ) ? ext_->mode_ : NULL;
+    if( mode != NULL )
+    {
+        for( uint16_t k = 0; k < mode->num_entries; ++k )
+        {
+            if( mode->entries[k].task == task_index ) return mode->entries[k].interval;
+        }
+        return EVENT_DRIVEN;
+    }
+
+    (void)fetch(task_index, func, interval);
+
+    return interval;
+}
+
+/**
+ * @brief   Changes the interval of task [task_index] in a RAM task table.
+ *          Unlike a direct write to Task::interval, an interval of 0 set
+ *          here makes the task continuous: it runs on passes without a tick.
+ * 
+ * @param task_index Index of the task in the table passed to init()
+ * @param interval   New interval, 0 for a continuous task
+ * @return true     On success
+ * @return false    When task_index is out of range or the tasks are in a const [TaskDef] table
+ */
+template <typename TickT>
+bool BasicScheduler<TickT>::setInterval(const uint16_t task_index, const TickT interval)
+{
+    bool continuous = false;
+
+    if( task_table_ == NULL || task_index >= num_tasks_ ) return false;
+
+    task_table_[task_index].interval = interval;
+
+    /* Recompute whether passes without a tick still scan */
+    for( uint16_t i = 0; i < num_tasks_; ++i )
+    {
+        if( task_table_[i].interval == 0 ) continuous = true;
+    }
+
+    const Mode* const modes = ( ext_ != NULL ) ? ext_->modes_ : NULL;
+    for( uint16_t m = 0; modes != NULL && m < ext_->num_modes_; ++m )
+    {
+        for( uint16_t k = 0; k < modes[m].num_entries; ++k )
+        {
+            if( modes[m].entries[k].interval == 0 ) continuous = true;
+        }
+    }
+
+    continuous_ = continuous;
+    return true;
+}
+
+/**
+ * @brief   Feeds the governor with a pass that spanned [span] ticks, and
+ *          takes at most one throttling step per tick
+ * 
+ * @param span  Ticks that arrived during the pass
+ * @param ctr   Tick counter read at the end of the pass
+ */
+template <typename TickT>
+void BasicScheduler<TickT>::govern(const TickT span, const TickT ctr)
+{
+    Governor* const gov = ext_->governor_;
+
+    if( span != 0 ) gov->busy_ = true;
+    if( ctr == gov->last_tick_ ) return;
+    gov->last_tick_ = ctr;
+
+    if( gov->worst_late_ > gov->late_limit_ )
+    {
+        gov->calm_ = 0;
+        if( ++gov->overloaded_ >= gov->stretch_after_ )
+        {
+            gov->overloaded_ = 0;
+            throttle(true, ctr);
+        }
+    }
+    else if( gov->worst_late_ == 0 && !gov->busy_ )
+    {
+        gov->overloaded_ = 0;
+        if( ++gov->calm_ >= gov->restore_after_ )
+        {
+            gov->calm_ = 0;
+            throttle(false, ctr);
+        }
+    }
+    else
+    {
+        /* Dead band */
+        gov->overloaded_ = 0;
+        gov->calm_ = 0;
+    }
+
+    gov->worst_late_ = 0;
+    gov->busy_ = false;
+}
+
+/**
+ * @brief   Doubles the effective intervals of the least important tasks that
+ *          can still stretch, or halves those of the most important tasks
+ *          that can still be restored, within their limits
+ * 
+ * @param stretch   True to stretch, false to restore
+ * @param ctr       Tick counter read at the end of the pass
+ */
+template <typename TickT>
+void BasicScheduler<TickT>::throttle(const bool stretch, const TickT ctr)
+{
+    const Governor* const gov = ext_->governor_;
+    TickT* const effective = gov->effective_;
+    uint8_t importance;
+    TickT min_interval;
+    TickT max_interval;
+    bool found = false;
+    uint8_t level = 0;
+
+    /* Pass 1: pick the importance level to change */
+    for( uint16_t i = 0; i < num_tasks_; ++i )
+    {
+        limits(gov, i, importance, min_interval, max_interval);
+
+        if( stretch && effective[i] < max_interval && ( !found || importance < level ) )
+        {
+            level = importance;
+            found = true;
+        }
+        else if( !stretch && effective[i] > min_interval && ( !found || importance > level ) )
+        {
+            level = importance;
+            found = true;
+        }
+    }
+
+    if( !found ) return;
+
+    /* Pass 2: change every task of that level */
+    for( uint16_t i = 0; i < num_tasks_; ++i )
+    {
+        limits(gov, i, importance, min_interval, max_interval);
+        if( importance != level ) continue;
+
+        const TickT e = effective[i];
+        if( stretch && e < max_interval )
+        {
+            effective[i] = ( e == 0 ) ? (TickT)1 :
+                           ( e >= (TickT)( max_interval - e ) ) ? max_interval : (TickT)( e * 2 );
+        }
+        else if( !stretch && e > min_interval )
+        {
+            effective[i] = ( (TickT)( e / 2 ) > min_interval ) ? (TickT)( e / 2 ) : min_interval;
+
+            /* A task overdue on its shorter interval runs now, not late */
+            void (*func)();
+            TickT interval;
+            TaskState* const state = fetch(i, func, interval);
+            if( (TickT)( ctr - state->last_called_ ) > interval )
+            {
+                state->last_called_ = (TickT)( ctr - interval );
+
+                /* Scan on the next pass even without a tick, or it is late */
+                scan_tick_ = (TickT)( ctr - 1 );
+            }
+        }
+    }
+}
+
+/**
+ * @brief   Reads the tick counter for the due-checks at [position] of the pass,
+ *          logging tick arrivals (or injecting them on replay)
+ * 
+ * @param position  PASS_START, task index, or period class index
+ *                  when grouped, PASS_END for the governor, then
+ *                  num_tasks + k for the k-th child
+ * @return TickT    Tick counter
+ */
+template <typename TickT>
+inline TickT BasicScheduler<TickT>::observe(const uint16_t position)
+{
+#if LEAN_SCHEDULER_RECORDER
+    static_assert(PASS_START == Recorder::PASS_START, "the log names the first read of a pass");
+    static_assert(PASS_END == Recorder::PASS_END, "the log names the governor's read");
+
+    if( ext_ == NULL || ext_->recorder_ == NULL ) return readTick();
+
+    Recorder* const recorder = ext_->recorder_;
+
+    /* Replay: the recorded ticks arrive right before this read */
+    if( recorder->replaying() )
+        sys_tick_ctr_ = (TickT)( sys_tick_ctr_ + recorder->ticksDue(position) );
+
+    const TickT ctr = readTick();
+    if( ctr != ext_->rec_tick_ ) recorder->tickSeen(position, (uint64_t)(TickT)( ctr - ext_->rec_tick_ ));
+    ext_->rec_tick_ = ctr;
+
+    return ctr;
+#else
+    (void)position;
+    return readTick();
+#endif
+}
+
+/**
+ * @brief   Calls task [i], timing it when statistics are attached
+ * 
+ * @param i     Index of the task
+ * @param func  Task function
+ */
+template <typename TickT>
+inline void BasicScheduler<TickT>::dispatch(const uint16_t i, void (*func)())
+{
+    if( ext_ == NULL )
+    {
+        (*func)();
+        return;
+    }
+
+#if LEAN_SCHEDULER_RECORDER
+    if( ext_->recorder_ != NULL ) ext_->recorder_->dispatched(i);
+#endif
+
+#if LEAN_SCHEDULER_STATS
+    SchedulerStats* const stats = ext_->stats_;
+    if( stats != NULL )
+    {
+        const uint32_t start = stats->now();
+        (*func)();
+        stats->charge(i, stats->now() - start);
+        return;
+    }
+#endif
+
+    (void)i;    /* Unused when both hooks are compiled out */
+    (*func)();
+}
+
+/**
+ * @brief   Merges the periodic tasks that share an interval and a phase
+ *          into period classes, so that run() checks each class once and
+ *          dispatches its members back-to-back. Tasks with a unique
+ *          interval or phase end up in a class of their own, which is
+ *          the same as an individual check. Event-driven tasks stay
+ *          outside the classes and only run when notified.
+ *          Within a class, members run in table order; classes run in
+ *          the table order of their first member.
+ *          Call again after changing an interval; phases are kept.
+ * 
+ * @param classes       Storage for up to [max_classes] period classes
+ * @param max_classes   Number of members in array [classes]
+ * @param members       Storage for one task index per task passed to init()
+ * @return true     When the tasks are grouped
+ * @return false    When an array is null, without an extension, or when there
+ *                  are more distinct interval/phase pairs than [max_classes];
+ *                  run() then keeps checking every task individually.
+ */
+template <typename TickT>
+bool BasicScheduler<TickT>::group(PeriodClass* const classes, const uint16_t max_classes, uint16_t* const members)
+{
+    void (*func)();
+    TickT interval;
+    TaskState* state;
+    uint16_t num_classes = 0;
+    uint16_t c;
+
+    if( ext_ == NULL || classes == NULL || members == NULL || ext_->governor_ != NULL || ext_->modes_ != NULL ) return false;
+
+    /* Start again from the per-task phases */
+    ungroup();
+
+    /* Pass 1: find the classes and count their members */
+    for( uint16_t i = 0; i < num_tasks_; ++i )
+    {
+        state = fetch(i, func, interval);
+        if( interval == EVENT_DRIVEN ) continue;
+
+        /* Continuous tasks share one class regardless of phase */
+        for( c = 0; c < num_classes; ++c )
+        {
+            if( classes[c].interval_ == interval &&
+                ( interval == 0 || classes[c].last_called_ == state->last_called_ ) )
+                break;
+        }
+
+        if( c == num_classes )
+        {
+            if( num_classes == max_classes ) return false;
+
+            classes[c].interval_ = interval;
+            classes[c].last_called_ = state->last_called_;
+            classes[c].count_ = 0;
+            ++num_classes;
+        }
+        ++classes[c].count_;
+    }
+
+    /* Lay the classes out back-to-back in [members] */
+    uint16_t first = 0;
+    for( c = 0; c < num_classes; ++c )
+    {
+        classes[c].first_ = first;
+        first += classes[c].count_;
+        classes[c].count_ = 0;
+    }
+
+    /* Pass 2: fill in the members, in table order */
+    for( uint16_t i = 0; i < num_tasks_; ++i )
+    {
+        state = fetch(i, func, interval);
+        if( interval == EVENT_DRIVEN ) continue;
+
+        for( c = 0; c < num_classes; ++c )
+        {
+            if( classes[c].interval_ == interval &&
+                ( interval == 0 || classes[c].last_called_ == state->last_called_ ) )
+                break;
+        }
+        members[classes[c].first_ + classes[c].count_++] = i;
+    }
+
+    ext_->num_classes_ = num_classes;
+    ext_->class_members_ = members;
+    ext_->classes_ = classes;
+
+    return true;
+}
+
+/**
+ * @brief   Drops the period classes, handing their phase back to the members
+ * 
+ */
+template <typename TickT>
+void BasicScheduler<TickT>::ungroup(void)
+{
+    void (*func)();
+    TickT interval;
+
+    const PeriodClass* const classes = ext_->classes_;
+    if( classes == NULL ) return;
+
+    for( uint16_t c = 0; c < ext_->num_classes_; ++c )
+    {
+        for( uint16_t m = 0; m < classes[c].count_; ++m )
+        {
+            fetch(ext_->class_members_[classes[c].first_ + m], func, interval)->last_called_ = classes[c].last_called_;
+        }
+    }
+
+    ext_->classes_ = NULL;
+}
+
+/**
+ * @brief   Runs the period classes built by group()
+ * 
+ * @param events    True when at least one task was notified
+ */
+template <typename TickT>
+void BasicScheduler<TickT>::runGrouped(const bool events)
+{
+    TickT sysctr;
+    void (*func)();
+    TickT interval;
+    TaskState* state;
+    Extension* const ext = ext_;
+
+    /* Loop across the period classes */
+    for( uint16_t c = 0; c < ext->num_classes_; ++c )
+    {
+        PeriodClass& pc = ext->classes_[c];
+
+        /* obtain a copy of the sys_tick_ctr at the execution to avoid concurrency */
+        sysctr = observe(c);
+
+        /* One due-check for the whole class */
+        if( pc.interval_ != 0 && (TickT)( sysctr - pc.last_called_ ) < pc.interval_ )
+            continue;
+
+        /* Dispatch the members back-to-back */
+        const uint16_t* member = &ext->class_members_[pc.first_];
+        for( uint16_t m = 0; m < pc.count_; ++m )
+        {
+            state = fetch(member[m], func, interval);
+
+            /* A due task also serves its pending wake-up */
+            if( events && state->pending_ != 0 )
+            {
+                state->pending_ = 0;
+#if LEAN_SCHEDULER_RECORDER
+                if( ext->recorder_ != NULL ) ext->recorder_->wake(member[m]);
+#endif
+            }
+
+            dispatch(member[m], func);
+        }
+
+        if( pc.interval_ != 0 ) pc.last_called_ = sysctr;
+    }
+
+    if( !events ) return;
+
+    /* Woken tasks whose class was not due, and event-driven tasks */
+    for( uint16_t i = 0; i < num_tasks_; ++i )
+    {
+        state = fetch(i, func, interval);
+        if( state->pending_ == 0 ) continue;
+
+        state->pending_ = 0;
+#if LEAN_SCHEDULER_RECORDER
+        if( ext->recorder_ != NULL ) ext->recorder_->wake(i);
+#endif
+        dispatch(i, func);
+    }
+}
+
+/**
+ * @brief   Detaches all children, so they can be attached again
+ * 
+ */
+template <typename TickT>
+void BasicScheduler<TickT>::detachChildren(void)
+{
+    BasicScheduler* child = ext_->children_;
+    ext_->children_ = NULL;
+
+    while( child != NULL )
+    {
+        BasicScheduler* const next = child->ext_->next_child_;
+        child->ext_->next_child_ = NULL;
+        child->ext_->parent_ = NULL;
+        child = next;
+    }
+}
+
+/**
+ * @brief   Detaches the features from the extension, if any
+ * 
+ */
+template <typename TickT>
+void BasicScheduler<TickT>::detachFeatures(void)
+{
+    if( ext_ == NULL ) return;
+
+    ext_->classes_ = NULL;
+    ext_->stats_ = NULL;
+    ext_->recorder_ = NULL;
+    ext_->governor_ = NULL;
+    ext_->modes_ = NULL;
+    ext_->mode_ = NULL;
+    detachChildren();
+}
+
+/**
+ * @brief   True when a pass would find nothing to run: no tick since the
+ *          last pass, no wake-up and no continuous task
+ * 
+ */
+template <typename TickT>
+inline bool BasicScheduler<TickT>::idle(void) const
+{
+    return readTick() == scan_tick_ && any_pending_ == 0 && !continuous_;
+}
+
+/**
+ * @brief   Releases the children attached with attachChild() whose divider
+ *          has elapsed, and the time bases whose counter advanced, and runs
+ *          them. A dormant child costs one check. With a recorder attached,
+ *          the read of the counter and the release of the k-th child are
+ *          logged at position [num_tasks + k]. A time base runs on its own
+ *          counter, which the log does not hold, so a replay can only check
+ *          its releases.
+ * 
+ */
+template <typename TickT>
+void BasicScheduler<TickT>::runChildren(void)
+{
+    uint16_t k = 0;
+
+    for( BasicScheduler* child = ext_->children_; child != NULL; child = child->ext_->next_child_, ++k )
+    {
+        Extension* const link = child->ext_;
+
+        if( link->divider_ == 0 )
+        {
+            /* Independent time base: ticked by its own source */
+            if( child->idle() ) continue;
+        }
+        else
+        {
+            /* A logged read, so a replay releases the child on the same pass */
+            const TickT elapsed = (TickT)( observe((uint16_t)( num_tasks_ + k )) - link->parent_last_ );
+
+            if( elapsed < link->divider_ && child->any_pending_ == 0 )
+                continue;
+
+            /* Release one child tick per whole divider, keeping the phase */
+            const TickT steps = (TickT)( elapsed / link->divider_ );
+            link->parent_last_ = (TickT)( link->parent_last_ + steps * link->divider_ );
+            child->sys_tick_ctr_ = (TickT)( child->sys_tick_ctr_ + steps );
+        }
+
+#if LEAN_SCHEDULER_RECORDER
+        if( ext_->recorder_ != NULL ) ext_->recorder_->dispatched((uint16_t)( num_tasks_ + k ));
+#endif
+
+#if LEAN_SCHEDULER_STATS
+        SchedulerStats* const stats = ext_->stats_;
+        if( stats != NULL )
+        {
+            /* Roll the subsystem up into the parent's statistics */
+            const uint32_t start = stats->now();
+            child->run();
+            stats->charge((uint16_t)( num_tasks_ + k ), stats->now() - start);
+            continue;
+        }
+#endif
+
+        child->run();
+    }
 }
 
 /**
  * @brief Runs the tasks registered via init().
  * 
  */
-void Scheduler::run(void)
+template <typename TickT>
+void BasicScheduler<TickT>::run(void)
+{
+    Extension* const ext = ext_;
+
+    started_ = true;
+#if LEAN_SCHEDULER_RECORDER
+    if( ext != NULL && ext->recorder_ != NULL ) ext->recorder_->pass();
+#endif
+
+    const TickT start = observe(PASS_START);
+
+    /*  Switch modes between passes: a pointer swap, the task states are
+     *  untouched. Wake-ups held for tasks of the new mode are picked up,
+     *  and the new dispatch table is scanned even without a tick.
+     */
+    if( ext != NULL && ext->mode_ != NULL )
+    {
+        const uint16_t requested = ext->requested_mode_;
+        if( requested != ext->mode_index_ )
+        {
+            ext->mode_index_ = requested;
+            ext->mode_ = &ext->modes_[requested];
+            any_pending_ = 1;
+            scan_tick_ = (TickT)( start - 1 );
+#if LEAN_SCHEDULER_RECORDER
+            if( ext->recorder_ != NULL ) ext->recorder_->modeSwitched(requested);
+#endif
+        }
+    }
+
+    /*  Consume the summary flag before scanning, so a notify() arriving
+     *  mid-pass is picked up on the next pass at the latest.
+     */
+    const bool events = ( any_pending_ != 0 );
+    if( events ) any_pending_ = 0;
+
+#if LEAN_SCHEDULER_STATS
+    /* Account for the pass; publishes the statistics once per tick */
+    if( ext != NULL && ext->stats_ != NULL )
+    {
+        ext->stats_->beginPass((TickT)( start - ext->stats_tick_ ));
+        ext->stats_tick_ = start;
+    }
+#endif
+
+    /*  Due-checks can only change when the counter advanced, so a pass
+     *  without a tick, a wake-up or a continuous task skips them. The
+     *  counter read is logged, so a replay skips the same passes.
+     */
+    if( events || continuous_ || start != scan_tick_ )
+    {
+        scan_tick_ = start;
+
+        if( ext == NULL && task_table_ != NULL && !events )
+            runPlain();
+        else if( ext != NULL && ext->classes_ != NULL )
+            runGrouped(events);
+        else
+            runTasks(events);
+    }
+
+    if( ext == NULL ) return;
+
+    if( ext->governor_ != NULL )
+    {
+        /* Logged, so a replay throttles at the same pass */
+        const TickT end = observe(PASS_END);
+        govern((TickT)( end - start ), end);
+    }
+
+    if( ext->children_ != NULL ) runChildren();
+}
+
+/**
+ * @brief   Runs a RAM task table one task at a time, for a pass without
+ *          wake-ups or optional features: nothing but the due-checks
+ * 
+ */
+template <typename TickT>
+void BasicScheduler<TickT>::runPlain(void)
 {
-    uint32_t sysctr;
+    Task* const table = task_table_;
+    const uint16_t count = num_tasks_;
 
     /* Loop across the tasks */
-    for( uint16_t i = 0; i < num_tasks_; ++i )
+    for( uint16_t i = 0; i < count; ++i )
+    {
+        Task& task = table[i];
+
+        /* obtain a copy of the sys_tick_ctr at the execution to avoid concurrency */
+        const TickT sysctr = readTick();
+
+        /* Breaks the loop on NULL existence */
+        if( task.func == NULL )
+            break;
+
+        /* Same due-check as runTasks(). An EVENT_DRIVEN interval is
+         * never due, so it is compared last, off the common path */
+        const TickT interval = task.interval;
+        if( interval == 0 )
+        {
+            (*task.func)();
+        }
+        else if ( (TickT)( sysctr - task.state_.last_called_ ) >= interval &&
+                  interval != EVENT_DRIVEN )
+        {
+            (*task.func)();
+            task.state_.last_called_ = sysctr;
+        }
+    }
+}
+
+/**
+ * @brief   Runs the task table one task at a time
+ * 
+ * @param events    True when at least one task was notified
+ */
+template <typename TickT>
+void BasicScheduler<TickT>::runTasks(const bool events)
+{
+    TickT sysctr;
+    void (*func)();
+    TickT interval;
+    TaskState* state;
+    bool woken;
+
+    /* The active mode's dispatch table replaces the task table */
+    const Mode* const mode = ( ext_ != NULL ) ? ext_->mode_ : NULL;
+    const ModeEntry* const entries = ( mode != NULL ) ? mode->entries : NULL;
+    const uint16_t count = ( mode != NULL ) ? mode->num_entries : num_tasks_;
+    Governor* const gov = ( ext_ != NULL ) ? ext_->governor_ : NULL;
+#if LEAN_SCHEDULER_RECORDER
+    Recorder* const recorder = ( ext_ != NULL ) ? ext_->recorder_ : NULL;
+#endif
+
+    /* Loop across the tasks */
+    for( uint16_t k = 0; k < count; ++k )
     {   
+        const uint16_t i = ( entries != NULL ) ? entries[k].task : k;
+
         /* obtain a copy of the sys_tick_ctr at the execution to avoid concurrency */
-        sysctr = sys_tick_ctr_;
+        sysctr = observe(k);
+
+        state = fetch(i, func, interval);
+        if( entries != NULL ) interval = entries[k].interval;
 
         /* Breaks the loop on NULL existence */
-        if( task_table_[i].func == NULL ) 
+        if( func == NULL ) 
             break;
 
+        /* Consume a pending wake-up, if any */
+        woken = events && ( state->pending_ != 0 );
+        if( woken )
+        {
+            state->pending_ = 0;
+#if LEAN_SCHEDULER_RECORDER
+            if( recorder != NULL ) recorder->wake(i);
+#endif
+        }
+
         /* Run the tasks */
-        if( task_table_[i].interval == 0 )
+        if( interval == 0 )
         {
             /* Run continuous tasks */
-            (*(task_table_[i].func))();
+            dispatch(i, func);
         }
-        else if ( sysctr - task_table_[i].last_called_ >= task_table_[i].interval )
+        else if ( interval != EVENT_DRIVEN &&
+                  (TickT)( sysctr - state->last_called_ ) >= interval )
         {
-            /* Run the tasks that are already due */
-            (*(task_table_[i].func))();
+            /* Run the tasks that are already due.
+             * The cast keeps the subtraction modulo the width of TickT,
+             * as narrow types are promoted to int before subtracting.
+             */
+            if( gov != NULL )
+            {
+                const TickT late = (TickT)( sysctr - state->last_called_ - interval );
+                if( late > gov->worst_late_ ) gov->worst_late_ = late;
+            }
+
+            dispatch(i, func);
 
             /* Update last_called_. 
              * using sysctr instead of sys_tick_ctr makes sure that 
              * the counter value is the same at the start and end of the function
              */
-            task_table_[i].last_called_ = sysctr;
+            state->last_called_ = sysctr;
+        }
+        else if ( woken )
+        {
+            /* Run woken tasks without touching their periodic phase */
+            dispatch(i, func);
         }
         else
         {
@@ -155,3 +1385,15 @@ void Scheduler::run(void)
         
     }
 }
+
+/*  Explicit instantiations.
+ *  Define LEAN_SCHEDULER_TICK_TYPE to build only the width in use.
+ */
+#ifdef LEAN_SCHEDULER_TICK_TYPE
+template class BasicScheduler<LEAN_SCHEDULER_TICK_TYPE>;
+#else
+template class BasicScheduler<uint8_t>;
+template class BasicScheduler<uint16_t>;
+template class BasicScheduler<uint32_t>;
+template class BasicScheduler<uint64_t>;
+#endif
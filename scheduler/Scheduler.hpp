@@ -32,6 +32,10 @@
 #include <stdint.h>
 #include <stddef.h>
 
+/* Optional features, see SchedulerStats.hpp and Recorder.hpp */
+class SchedulerStats;
+class Recorder;
+
 /* Make sure UINT32_MAX is present*/
 #ifndef UINT32_MAX
     #define UINT32_MAX  (0xFFFFFFFF)
@@ -41,13 +45,60 @@
     #define NULL (0)
 #endif
 
+/*  Widest tick counter, in bytes, that the target loads in one instruction.
+ *  Wider counters are read with a retry loop against the tick() ISR.
+ *  Define it to 1 on 8-bit parts, 2 on 16-bit parts.
+ */
+#ifndef LEAN_SCHEDULER_ATOMIC_BYTES
+    #define LEAN_SCHEDULER_ATOMIC_BYTES (sizeof(void*))
+#endif
+
+/*  Statistics hooks in run(). Define it to 0 to compile them out: the
+ *  scheduler then neither includes nor links SchedulerStats (and <atomic>),
+ *  and attachStats() returns false.
+ */
+#ifndef LEAN_SCHEDULER_STATS
+    #define LEAN_SCHEDULER_STATS 1
+#endif
+
+/*  Recorder hooks in run(). Define it to 0 to compile them out: the
+ *  scheduler then neither includes nor links Recorder (and <atomic>),
+ *  and attachRecorder() returns false.
+ */
+#ifndef LEAN_SCHEDULER_RECORDER
+    #define LEAN_SCHEDULER_RECORDER 1
+#endif
+
 /**
  * Scheduler Class Declaration
+ * 
+ * TickT sets the width of the tick counter and of the task intervals
+ * (uint8_t, uint16_t, uint32_t or uint64_t). Counters wrap around at
+ * the width of TickT; intervals up to one less than EVENT_DRIVEN work
+ * across the wrap. See the [Scheduler] typedef for the default width.
+ * A TickT wider than LEAN_SCHEDULER_ATOMIC_BYTES costs a retry loop on
+ * every read of the counter outside tick().
  */
-class Scheduler
+template <typename TickT>
+class BasicScheduler
 {
 public:
 
+    /**
+     * TaskState class
+     * Run-time state of a task; the only part of a task that must live in RAM
+     */
+    class TaskState
+    {
+        public:
+            friend class BasicScheduler; /* Give Scheduler access to internal variables */
+
+        private:
+            /* Internal variables */
+            TickT last_called_ = 0;
+            volatile uint8_t pending_ = 0;  /*!< Set by notify(), consumed by run() */
+    };
+
     /**
      * Task class
      * This represents each tasks handled by the scheduler
@@ -55,42 +106,227 @@ public:
     class Task
     {
         public:
-            friend class Scheduler; /* Give Scheduler access to internal variables */
+            friend class BasicScheduler; /* Give Scheduler access to internal variables */
             
-            /* Constructor */
+            /* Constructor. Task has volatile members, so a table of these
+             * lives in RAM; use a const [TaskDef] table for flash. */
             Task(){}
-            Task(void (*func)(), volatile uint32_t interval) : 
+            Task(void (*func)(), TickT interval) : 
                 func(func), 
                 interval(interval) 
             {
             }
             
             
-            /* Public members */
+            /* Public members. Change [interval] at run time through
+             * setInterval(): a direct write does not make a task
+             * continuous, or stop it from being one. */
             void (*func)();
-            volatile uint32_t interval;
+            volatile TickT interval;
         
         private:
             /* Internal variables */
-            uint32_t last_called_ = 0;
+            TaskState state_;
+    };
+
+    /**
+     * TaskDef struct
+     * Immutable part of a task. Being an aggregate, a const table of these
+     * is initialized at compile time and can be placed in flash, leaving
+     * only a [TaskState] per task in RAM.
+     */
+    struct TaskDef
+    {
+        void (*func)();
+        TickT interval;
     };
 
+    /**
+     * PeriodClass class
+     * Tasks sharing one interval and phase, whose due-check is done once
+     * per pass for all of them. Storage is provided through group().
+     */
+    class PeriodClass
+    {
+        public:
+            friend class BasicScheduler; /* Give Scheduler access to internal variables */
+
+        private:
+            /* Internal variables */
+            TickT interval_ = 0;
+            TickT last_called_ = 0;
+            uint16_t first_ = 0;    /*!< Index of the first member in the members array */
+            uint16_t count_ = 0;    /*!< Number of members */
+    };
+
+    /**
+     * ModeEntry struct
+     * One task of a mode's dispatch table, with the interval it runs at in that mode
+     */
+    struct ModeEntry
+    {
+        uint16_t task;          /*!< Index in the table passed to init() */
+        TickT interval;
+    };
+
+    /**
+     * Mode struct
+     * Named operating mode. Being aggregates, modes and their dispatch
+     * tables are built at compile time and can be placed in flash.
+     */
+    struct Mode
+    {
+        const char* name;
+        const ModeEntry* entries;   /*!< Dispatch table, in dispatch order */
+        uint16_t num_entries;
+    };
+
+    /**
+     * Limits struct
+     * Throttling range of one task, passed to the Governor in a table
+     * parallel to the task table. A const table can be placed in flash.
+     */
+    struct Limits
+    {
+        uint8_t importance;     /*!< Throttling order under overload: lowest is stretched first */
+        TickT min_interval;     /*!< Shortest interval the Governor may restore to; 0 uses the task interval */
+        TickT max_interval;     /*!< Longest interval the Governor may stretch to; 0 uses the task interval */
+    };
+
+    /**
+     * Governor class
+     * Stretches the intervals of less important tasks under sustained
+     * overload, and restores them once the overload is gone.
+     * The limits and the storage for the effective intervals are
+     * provided through init().
+     */
+    class Governor
+    {
+        public:
+            friend class BasicScheduler; /* Give Scheduler access to internal variables */
+
+            Governor(){}
+            bool init(const Limits* const limits, TickT* const effective, const uint16_t num_tasks,
+                      const TickT late_limit, const uint16_t stretch_after, const uint16_t restore_after);
+
+        private:
+            /* Internal variables */
+            const Limits* limits_ = NULL;   /*!< Throttling range per task */
+            TickT* effective_ = NULL;       /*!< Effective interval per task */
+            uint16_t num_tasks_ = 0;        /*!< Number of members in [effective_] */
+            TickT late_limit_ = 0;          /*!< Lateness, in ticks, above which a tick counts as overloaded */
+            uint16_t stretch_after_ = 1;    /*!< Overloaded ticks in a row before a stretch step */
+            uint16_t restore_after_ = 1;    /*!< Calm ticks in a row before a restore step */
+            uint16_t overloaded_ = 0;       /*!< Overloaded ticks in a row */
+            uint16_t calm_ = 0;             /*!< Calm ticks in a row */
+            TickT worst_late_ = 0;          /*!< Worst dispatch lateness since the last evaluation */
+            bool busy_ = false;             /*!< A pass spanned a tick since the last evaluation */
+            TickT last_tick_ = 0;           /*!< Tick counter at the last evaluation */
+    };
+
+    /**
+     * Extension class
+     * State of the optional features: period classes, statistics,
+     * recording, nested schedulers and time bases, modes and the governor.
+     * A scheduler using none of them does without it; storage is provided
+     * through extend().
+     */
+    class Extension
+    {
+        public:
+            friend class BasicScheduler; /* Give Scheduler access to internal variables */
+
+            Extension(){}
+
+        private:
+            /* Internal variables */
+            PeriodClass* classes_ = NULL;           /*!< Period classes built by group(), NULL when ungrouped */
+            uint16_t num_classes_ = 0;              /*!< Number of period classes in use */
+            uint16_t* class_members_ = NULL;        /*!< Task indices, contiguous per period class */
+            SchedulerStats* stats_ = NULL;          /*!< Live statistics, NULL when not measured */
+            TickT stats_tick_ = 0;                  /*!< Tick counter seen by the previous measured pass */
+            Recorder* recorder_ = NULL;             /*!< Record/replay log, NULL when not recording */
+            TickT rec_tick_ = 0;                    /*!< Tick counter at the previous recorded read */
+            BasicScheduler* children_ = NULL;       /*!< First nested scheduler, NULL when none */
+            BasicScheduler* next_child_ = NULL;     /*!< Next sibling under the same parent */
+            BasicScheduler* parent_ = NULL;         /*!< Scheduler this one is nested in, NULL at the top */
+            TickT parent_last_ = 0;                 /*!< Parent tick of the last child tick released */
+            TickT divider_ = 1;                     /*!< Parent ticks per child tick, 0 for an independent time base */
+            const Mode* modes_ = NULL;              /*!< Modes passed to initModes(), NULL when not used */
+            uint16_t num_modes_ = 0;                /*!< Number of members in [modes_] */
+            const Mode* mode_ = NULL;               /*!< Active mode, NULL when not used */
+            uint16_t mode_index_ = 0;               /*!< Index of the active mode */
+            volatile uint16_t requested_mode_ = 0;  /*!< Mode to switch to at the start of the next pass */
+            Governor* governor_ = NULL;             /*!< Interval throttling, NULL when intervals are fixed */
+    };
+
+    /**
+     * Interval value for tasks that never become due on the tick counter
+     * and only run when woken through notify()
+     */
+    static const TickT EVENT_DRIVEN = (TickT)~(TickT)0;
+
     /* Constructor */
-    Scheduler(/* args */);
-    ~Scheduler();
+    BasicScheduler(/* args */);
+    ~BasicScheduler();
     
     /**
      * APIs
      */
     bool init(Task* const taskTable, const uint16_t num_tasks, const uint32_t systick_interval);
+    bool init(const TaskDef* const taskDefs, TaskState* const taskStates, const uint16_t num_tasks, const uint32_t systick_interval);
     void run(void);
-    uint32_t tick(void);
-    uint32_t getTickCount(void);
+    TickT tick(void);
+    TickT getTickCount(void);
+    bool notify(const uint16_t task_index);
+    bool extend(Extension* const ext);
+    bool group(PeriodClass* const classes, const uint16_t max_classes, uint16_t* const members);
+    bool attachStats(SchedulerStats* const stats);
+    bool attachRecorder(Recorder* const recorder);
+    bool attachChild(BasicScheduler* const child, const TickT divider);
+    bool attachTimeBase(BasicScheduler* const base);
+    bool attachGovernor(Governor* const governor);
+    bool initModes(const Mode* const modes, const uint16_t num_modes);
+    bool requestMode(const uint16_t mode_index);
+    uint16_t currentMode(void) const;
+    TickT effectiveInterval(const uint16_t task_index) const;
+    bool setInterval(const uint16_t task_index, const TickT interval);
 
 private:
+    static const uint16_t PASS_START = 0xFFFF;  /*!< observe() position of the read at the start of a pass */
+    static const uint16_t PASS_END = 0xFFFE;    /*!< observe() position of the governor's read after the tasks */
+
+    TickT readTick(void) const;
+    TaskState* fetch(const uint16_t i, void (*&func)(), TickT& interval) const;
+    void dispatch(const uint16_t i, void (*func)());
+    TickT observe(const uint16_t position);
+    void ungroup(void);
+    void runPlain(void);
+    void runTasks(const bool events);
+    void runGrouped(const bool events);
+    void runChildren(void);
+    void detachChildren(void);
+    void detachFeatures(void);
+    bool link(BasicScheduler* const child, const TickT divider);
+    bool idle(void) const;
+    void limits(const Governor* const gov, const uint16_t i, uint8_t& importance, TickT& min_interval, TickT& max_interval) const;
+    void govern(const TickT span, const TickT ctr);
+    void throttle(const bool stretch, const TickT ctr);
+
     /* Internal variables */
-    volatile uint32_t sys_tick_ctr_ = 0;    /*!< System tick counter */
+    volatile TickT sys_tick_ctr_ = 0;       /*!< System tick counter */
+    TickT scan_tick_ = 0;                   /*!< Tick counter at the last pass that ran the due-checks */
     uint16_t num_tasks_ = 0;                /*!< Number of tasks in the task table */
-    Task* task_table_ = NULL;               /*!< Pointer to the task table */
+    uint32_t systick_interval_ = 0;         /*!< Duration of a systick, in microseconds */
+    Task* task_table_ = NULL;               /*!< Pointer to the task table (RAM layout) */
+    const TaskDef* task_defs_ = NULL;       /*!< Pointer to the task definitions (const layout) */
+    TaskState* task_states_ = NULL;         /*!< Pointer to the task states (const layout) */
+    volatile uint8_t any_pending_ = 0;      /*!< Set when at least one task was notified */
+    bool continuous_ = false;               /*!< At least one task has interval 0, from init(), setInterval() or a mode */
+    bool started_ = false;                  /*!< run() was called since init() */
+    Extension* ext_ = NULL;                 /*!< Optional features, NULL when none are used */
 
 };
+
+/* Default scheduler: 32-bit tick counter and intervals */
+typedef BasicScheduler<uint32_t> Scheduler;
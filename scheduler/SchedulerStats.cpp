@@ -0,0 +1,198 @@
+/**
+ * @file SchedulerStats.cpp
+ * @author Niel Cansino (nielcansino@gmail.com)
+ * @brief Live scheduler statistics published through a sequence lock
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ */
+
+#include "SchedulerStats.hpp"
+
+/* Storage for the in-class constants, needed when they are odr-used */
+const uint16_t SchedulerStats::LOAD_ONE;
+const uint8_t SchedulerStats::DECAY_SHIFT;
+
+/* Number of attempts of read() before giving up on a busy writer */
+#define STATS_READ_RETRIES (8U)
+
+/**
+ * @brief Class constructor
+ * 
+ */
+SchedulerStats::SchedulerStats()
+{
+}
+
+/**
+ * @brief Destroy the SchedulerStats object
+ * 
+ */
+SchedulerStats::~SchedulerStats()
+{
+}
+
+/**
+ * @brief   Initializes the statistics block.
+ * 
+ * @param task_loads    Array of [TaskLoad], one per task of the scheduler
+ * @param num_tasks     Number of members in array [task_loads]
+ * @param clock_us      Free-running microsecond clock, wrapping at 2^32
+ * @return true     On successful initialization
+ * @return false    When an argument is null
+ */
+bool SchedulerStats::init(TaskLoad* const task_loads, const uint16_t num_tasks, uint32_t (*clock_us)(void))
+{
+    if( task_loads == NULL || clock_us == NULL ) return false;
+
+    task_loads_ = task_loads;
+    num_tasks_ = num_tasks;
+    clock_us_ = clock_us;
+
+    return true;
+}
+
+/**
+ * @brief   Starts measuring; called by the scheduler when the block is attached.
+ * 
+ * @param nominal_tick_us   systick_interval of the scheduler
+ */
+void SchedulerStats::begin(const uint32_t nominal_tick_us)
+{
+    seq_.store(seq_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    sample_ = Sample();
+    sample_.nominal_tick_us = nominal_tick_us;
+    sample_.tick_period_us = nominal_tick_us;
+    sample_.idle = LOAD_ONE;
+
+    for( uint16_t i = 0; i < num_tasks_; ++i )
+    {
+        task_loads_[i] = TaskLoad();
+    }
+
+    std::atomic_thread_fence(std::memory_order_release);
+    seq_.store(seq_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+    window_busy_us_ = 0;
+    window_passes_ = 0;
+    started_ = false;
+}
+
+/**
+ * @brief   Accounts for one run() pass; publishes the figures of the
+ *          previous tick when the tick counter has advanced.
+ * 
+ * @param ticks_elapsed Ticks since the previous pass
+ */
+void SchedulerStats::beginPass(const uint32_t ticks_elapsed)
+{
+    if( !started_ )
+    {
+        window_start_us_ = now();
+        started_ = true;
+    }
+    else if( ticks_elapsed != 0 )
+    {
+        publish(ticks_elapsed, now());
+    }
+
+    ++window_passes_;
+}
+
+/**
+ * @brief   Folds the current tick into the decayed figures, under the sequence lock
+ * 
+ * @param ticks     Ticks covered by the current window
+ * @param now_us    Clock at the end of the window
+ */
+void SchedulerStats::publish(const uint32_t ticks, const uint32_t now_us)
+{
+    const uint32_t elapsed = now_us - window_start_us_;
+    if( elapsed == 0 ) return;
+
+    /* Q15 fraction of [elapsed] spent in tasks, saturated at 100% */
+    uint32_t tick_load = (uint32_t)( ( (uint64_t)window_busy_us_ * LOAD_ONE ) / elapsed );
+    if( tick_load > LOAD_ONE ) tick_load = LOAD_ONE;
+
+    seq_.store(seq_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    sample_.ticks += ticks;
+    sample_.passes += window_passes_;
+    if( tick_load > sample_.worst_tick_load ) sample_.worst_tick_load = (uint16_t)tick_load;
+
+    /* Exponential decay: x += (new - x) / 2^DECAY_SHIFT */
+    sample_.idle = (uint16_t)( sample_.idle + ( ( (int32_t)( LOAD_ONE - tick_load ) - (int32_t)sample_.idle ) >> DECAY_SHIFT ) );
+    sample_.tick_period_us = (uint32_t)( (int64_t)sample_.tick_period_us + ( ( (int64_t)( elapsed / ticks ) - (int64_t)sample_.tick_period_us ) >> DECAY_SHIFT ) );
+
+    for( uint16_t i = 0; i < num_tasks_; ++i )
+    {
+        TaskLoad& tl = task_loads_[i];
+        uint32_t load = (uint32_t)( ( (uint64_t)tl.busy_us_ * LOAD_ONE ) / elapsed );
+        if( load > LOAD_ONE ) load = LOAD_ONE;
+
+        tl.load_ = (uint16_t)( tl.load_ + ( ( (int32_t)load - (int32_t)tl.load_ ) >> DECAY_SHIFT ) );
+        tl.busy_us_ = 0;
+    }
+
+    std::atomic_thread_fence(std::memory_order_release);
+    seq_.store(seq_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+    window_start_us_ = now_us;
+    window_busy_us_ = 0;
+    window_passes_ = 0;
+}
+
+/**
+ * @brief   Takes a consistent snapshot of the statistics. Never blocks the
+ *          scheduler; retries while an update is in progress.
+ * 
+ * @param sample        Receives the scheduler-wide figures
+ * @param task_loads    Receives the decayed load of each task, Q15; may be NULL
+ * @param max_tasks     Number of members in array [task_loads]
+ * @return true     On a consistent snapshot
+ * @return false    When the writer kept updating (e.g. read() preempted run())
+ */
+bool SchedulerStats::read(Sample& sample, uint16_t* const task_loads, const uint16_t max_tasks) const
+{
+    const uint16_t n = ( task_loads == NULL ) ? 0 : ( max_tasks < num_tasks_ ? max_tasks : num_tasks_ );
+
+    for( uint8_t attempt = 0; attempt < STATS_READ_RETRIES; ++attempt )
+    {
+        const uint32_t before = seq_.load(std::memory_order_acquire);
+        if( before & 1U ) continue;
+
+        sample = sample_;
+        for( uint16_t i = 0; i < n; ++i )
+        {
+            task_loads[i] = task_loads_[i].load_;
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if( seq_.load(std::memory_order_relaxed) == before ) return true;
+    }
+
+    return false;
+}
@@ -0,0 +1,136 @@
+/**
+ * @file SchedulerStats.hpp
+ * @author Niel Cansino (nielcansino@gmail.com)
+ * @brief Live scheduler statistics published through a sequence lock
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+
+#ifndef NULL
+    #define NULL (0)
+#endif
+
+/**
+ * SchedulerStats Class Declaration
+ * 
+ * Continuously updated statistics of a scheduler: decayed CPU load per
+ * task, idle fraction, measured tick period and worst per-tick load.
+ * 
+ * The scheduler is the only writer. Figures are accumulated privately
+ * during a tick and published once per tick under a sequence lock, so a
+ * reader on another core (or a debugger) gets a consistent snapshot
+ * through read() without ever blocking run().
+ * 
+ * Loads and fractions are Q15 fixed point: LOAD_ONE is 100%.
+ */
+class SchedulerStats
+{
+public:
+
+    static const uint16_t LOAD_ONE = 32768U;    /*!< 1.0 in Q15 */
+    static const uint8_t DECAY_SHIFT = 3;       /*!< Decay weight of a new tick: 1 / 2^DECAY_SHIFT */
+
+    /**
+     * Sample struct
+     * Scheduler-wide figures of one snapshot
+     */
+    struct Sample
+    {
+        uint32_t ticks;             /*!< Ticks observed since attach */
+        uint32_t passes;            /*!< run() passes since attach */
+        uint16_t idle;              /*!< Decayed fraction of time spent outside tasks, Q15 */
+        uint16_t worst_tick_load;   /*!< Highest fraction of a tick spent in tasks, Q15 */
+        uint32_t tick_period_us;    /*!< Decayed measured duration of a tick, in microseconds */
+        uint32_t nominal_tick_us;   /*!< systick_interval passed to init() */
+    };
+
+    /**
+     * TaskLoad class
+     * Per-task accumulator and decayed load; one per task, provided by the application
+     */
+    class TaskLoad
+    {
+        public:
+            friend class SchedulerStats; /* Give SchedulerStats access to internal variables */
+
+        private:
+            /* Internal variables */
+            uint32_t busy_us_ = 0;  /*!< Time spent in the task during the current tick */
+            uint16_t load_ = 0;     /*!< Decayed load, Q15 */
+    };
+
+    /* Constructor */
+    SchedulerStats();
+    ~SchedulerStats();
+
+    /**
+     * APIs
+     */
+    bool init(TaskLoad* const task_loads, const uint16_t num_tasks, uint32_t (*clock_us)(void));
+    bool read(Sample& sample, uint16_t* const task_loads, const uint16_t max_tasks) const;
+
+    /**
+     * Writer side, called by the scheduler
+     */
+    void begin(const uint32_t nominal_tick_us);
+    void beginPass(const uint32_t ticks_elapsed);
+
+    /* Current time of the clock passed to init() */
+    uint32_t now(void) const
+    {
+        return (*clock_us_)();
+    }
+
+    /* Charges [busy_us] of execution time to [task] */
+    void charge(const uint16_t task, const uint32_t busy_us)
+    {
+        window_busy_us_ += busy_us;
+        if( task < num_tasks_ ) task_loads_[task].busy_us_ += busy_us;
+    }
+
+private:
+    void publish(const uint32_t ticks, const uint32_t now_us);
+
+    /* Published figures, guarded by seq_. The scheduler is the only writer,
+     * so seq_ is bumped with a load and a store: no read-modify-write,
+     * which would need libatomic on cores without one (ARMv6-M, AVR). */
+    std::atomic<uint32_t> seq_{0};          /*!< Odd while an update is in progress */
+    Sample sample_ = Sample();
+
+    /* Writer-private accumulators */
+    TaskLoad* task_loads_ = NULL;           /*!< Per-task loads, one per task */
+    uint16_t num_tasks_ = 0;                /*!< Number of members in [task_loads_] */
+    uint32_t (*clock_us_)(void) = NULL;     /*!< Free-running microsecond clock */
+    uint32_t window_start_us_ = 0;          /*!< Clock at the start of the current tick */
+    uint32_t window_busy_us_ = 0;           /*!< Time spent in tasks during the current tick */
+    uint32_t window_passes_ = 0;            /*!< run() passes during the current tick */
+    bool started_ = false;                  /*!< False until the first pass after begin() */
+
+};
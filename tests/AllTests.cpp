@@ -12,4 +12,8 @@ int main(int ac, char** av)
 
 }
 
-IMPORT_TEST_GROUP(Lean_Scheduler_TestGroup);
\ No newline at end of file
+IMPORT_TEST_GROUP(Lean_Scheduler_TestGroup);
+IMPORT_TEST_GROUP(Channel_TestGroup);
+IMPORT_TEST_GROUP(SchedulerStats_TestGroup);
+IMPORT_TEST_GROUP(Recorder_TestGroup);
+IMPORT_TEST_GROUP(Governor_TestGroup);
\ No newline at end of file
@@ -0,0 +1,211 @@
+/**
+ * @file test_Channel.cpp
+ * @author Niel Cansino (nielcansino@gmail.com)
+ * @brief Test stub for the SPSC/MPSC message channels
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ */
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTestExt/MockSupport.h"
+#include "Scheduler.hpp"
+#include "Channel.hpp"
+
+#define CHANNEL_DEPTH (4)
+#define SYSTICK_INTERVAL_10mS (10000U) /* duration of a systick, in us */
+
+/**
+ * Mock consumer task
+ */
+void consumerTask();
+
+/**
+ * @brief Test group for the message channels
+ * 
+ */
+TEST_GROUP(Channel_TestGroup)
+{
+    SpscChannel<uint32_t, CHANNEL_DEPTH> spsc;
+    MpscChannel<uint32_t, CHANNEL_DEPTH> mpsc;
+
+    void teardown()
+    {
+        mock().clear();
+    }
+};
+
+/**
+ * @brief Messages written in place come out in order, and the
+ *        ring reports full/empty at its edges
+ * 
+ */
+TEST(Channel_TestGroup, spsc_FifoAndEdges)
+{
+    /* Empty after construction */
+    POINTERS_EQUAL(NULL, spsc.peek());
+
+    /* Fill to capacity */
+    for( uint32_t i = 0; i < CHANNEL_DEPTH; ++i )
+    {
+        uint32_t* slot = spsc.claim();
+        CHECK(slot != NULL);
+        *slot = 100 + i;
+        spsc.publish();
+    }
+    CHECK_EQUAL(CHANNEL_DEPTH, spsc.count());
+
+    /* No room left */
+    POINTERS_EQUAL(NULL, spsc.claim());
+
+    /* Drain in order */
+    for( uint32_t i = 0; i < CHANNEL_DEPTH; ++i )
+    {
+        uint32_t* slot = spsc.peek();
+        CHECK(slot != NULL);
+        CHECK_EQUAL(100 + i, *slot);
+        spsc.release();
+    }
+    POINTERS_EQUAL(NULL, spsc.peek());
+}
+
+/**
+ * @brief claim() hands out the slot that peek() later returns,
+ *        i.e. no copy is made; also checks index wraparound
+ * 
+ */
+TEST(Channel_TestGroup, spsc_ZeroCopyWrap)
+{
+    for( uint32_t i = 0; i < 3 * CHANNEL_DEPTH; ++i )
+    {
+        uint32_t* wr = spsc.claim();
+        *wr = i;
+        spsc.publish();
+
+        uint32_t* rd = spsc.peek();
+        POINTERS_EQUAL(wr, rd);
+        CHECK_EQUAL(i, *rd);
+        spsc.release();
+    }
+}
+
+/**
+ * @brief A slot claimed first but published last holds back
+ *        only the messages behind it
+ * 
+ */
+TEST(Channel_TestGroup, mpsc_OutOfOrderPublish)
+{
+    uint32_t* first = mpsc.claim();
+    uint32_t* second = mpsc.claim();
+    CHECK(first != NULL);
+    CHECK(second != NULL);
+    CHECK(first != second);
+
+    *second = 2;
+    mpsc.publish(second);
+
+    /* Oldest claim is not published yet */
+    POINTERS_EQUAL(NULL, mpsc.peek());
+
+    *first = 1;
+    mpsc.publish(first);
+
+    CHECK_EQUAL(1, *mpsc.peek());
+    mpsc.release();
+    CHECK_EQUAL(2, *mpsc.peek());
+    mpsc.release();
+    POINTERS_EQUAL(NULL, mpsc.peek());
+}
+
+/**
+ * @brief MPSC full/empty edges and reuse after wraparound
+ * 
+ */
+TEST(Channel_TestGroup, mpsc_FullAndWrap)
+{
+    for( uint32_t round = 0; round < 3; ++round )
+    {
+        for( uint32_t i = 0; i < CHANNEL_DEPTH; ++i )
+        {
+            uint32_t* slot = mpsc.claim();
+            CHECK(slot != NULL);
+            *slot = round * 10 + i;
+            mpsc.publish(slot);
+        }
+        POINTERS_EQUAL(NULL, mpsc.claim());
+
+        for( uint32_t i = 0; i < CHANNEL_DEPTH; ++i )
+        {
+            CHECK_EQUAL(round * 10 + i, *mpsc.peek());
+            mpsc.release();
+        }
+    }
+}
+
+/**
+ * @brief Publishing wakes an event-driven consumer task on the
+ *        next pass, without any tick
+ * 
+ */
+TEST(Channel_TestGroup, publish_WakesConsumer)
+{
+    Scheduler sch;
+    Scheduler::Task table[1] = {
+        {consumerTask, Scheduler::EVENT_DRIVEN}
+    };
+    CHECK_TRUE(sch.init(table, 1, SYSTICK_INTERVAL_10mS));
+    spsc.attach(sch, 0);
+    mpsc.attach(sch, 0);
+
+    /* Nothing published: consumer stays dormant */
+    mock().expectNoCall("consumerTask");
+    sch.run();
+    mock().checkExpectations();
+    mock().clear();
+
+    /* SPSC publish wakes it once */
+    *spsc.claim() = 7;
+    spsc.publish();
+    mock().expectOneCall("consumerTask");
+    sch.run();
+    sch.run();
+    mock().checkExpectations();
+    mock().clear();
+
+    /* MPSC publish wakes it too */
+    uint32_t* slot = mpsc.claim();
+    *slot = 8;
+    mpsc.publish(slot);
+    mock().expectOneCall("consumerTask");
+    sch.run();
+    mock().checkExpectations();
+    mock().clear();
+}
+
+/* 
+ * Mock Task definitions for Testing
+ */
+void consumerTask(){
+    mock().actualCall("consumerTask");
+}
@@ -0,0 +1,293 @@
+/**
+ * @file test_Governor.cpp
+ * @author Niel Cansino (nielcansino@gmail.com)
+ * @brief Simulation tests for the interval Governor
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ */
+
+
+#include "CppUTest/TestHarness.h"
+#include "Scheduler.hpp"
+
+#define GOV_NUM_TASKS (5)
+#define GOV_TICK_US (1000U)         /* duration of a simulated systick, in us */
+#define GOV_CRITICAL_COST_US (300U)
+#define GOV_SIM_TICKS (4000U)
+#define GOV_WARMUP_TICKS (1000U)
+
+/**
+ * Simulated time: tasks advance the clock by their cost and
+ * the tick ISR fires whenever a tick boundary is crossed
+ */
+static Scheduler* sim_sched = NULL;
+static uint32_t sim_time_us = 0;
+static uint32_t sim_next_tick_us = 0;
+static uint32_t optional_cost_us = 0;
+
+/* Lateness of the critical task, measured after the warm-up */
+static uint32_t critical_last = 0;
+static uint32_t critical_worst_late = 0;
+static uint32_t critical_late_total = 0;
+static uint32_t critical_calls = 0;
+
+static void spend(const uint32_t us)
+{
+    sim_time_us += us;
+    while( sim_time_us >= sim_next_tick_us )
+    {
+        (void)sim_sched->tick();
+        sim_next_tick_us += GOV_TICK_US;
+    }
+}
+
+static void criticalTask(void)
+{
+    const uint32_t now = sim_sched->getTickCount();
+
+    if( now >= GOV_WARMUP_TICKS )
+    {
+        const uint32_t late = now - critical_last - 1;
+        if( late > critical_worst_late ) critical_worst_late = late;
+        critical_late_total += late;
+        ++critical_calls;
+    }
+    critical_last = now;
+
+    spend(GOV_CRITICAL_COST_US);
+}
+
+static void optionalTask(void)
+{
+    spend(optional_cost_us);
+}
+
+/**
+ * @brief Test group for Governor
+ * 
+ */
+TEST_GROUP(Governor_TestGroup)
+{
+    /* One critical task at a fixed rate, four optional ones that may run 16x slower */
+    Scheduler::Task taskTable[GOV_NUM_TASKS] = {
+        {criticalTask, 1},
+        {optionalTask, 1},
+        {optionalTask, 1},
+        {optionalTask, 1},
+        {optionalTask, 1}
+    };
+    const Scheduler::Limits limits[GOV_NUM_TASKS] = {
+        {0, 0, 0},          /*!< fixed rate */
+        {2, 0, 16},
+        {2, 0, 16},
+        {1, 0, 16},         /*!< least important: stretched first */
+        {1, 0, 16}
+    };
+
+    Scheduler::Governor governor;
+    uint32_t effective[GOV_NUM_TASKS];
+    Scheduler myScheduler;
+    Scheduler::Extension ext;
+
+    void setup()
+    {
+        sim_sched = &myScheduler;
+        sim_time_us = 0;
+        sim_next_tick_us = GOV_TICK_US;
+        critical_last = 0;
+        critical_worst_late = 0;
+        critical_late_total = 0;
+        critical_calls = 0;
+        (void)myScheduler.init(taskTable, GOV_NUM_TASKS, GOV_TICK_US);
+        (void)myScheduler.extend(&ext);
+    }
+
+    /* Runs the scheduler for [ticks] simulated ticks, idling when a pass ends early */
+    void simulate(const uint32_t ticks)
+    {
+        while( myScheduler.getTickCount() < ticks )
+        {
+            const uint32_t start = myScheduler.getTickCount();
+            myScheduler.run();
+            if( myScheduler.getTickCount() == start ) spend(sim_next_tick_us - sim_time_us);
+        }
+    }
+};
+
+/**
+ * @brief Edge conditions on init and attach
+ * 
+ */
+TEST(Governor_TestGroup, init_EdgeConditions)
+{
+    Scheduler::PeriodClass classes[GOV_NUM_TASKS];
+    uint16_t members[GOV_NUM_TASKS];
+    Scheduler::Task badTable[1] = {
+        {optionalTask, 8}
+    };
+    const Scheduler::Limits badLimits[1] = {
+        {1, 10, 16}         /*!< interval below its min_interval */
+    };
+    Scheduler::Governor badGovernor;
+
+    CHECK_FALSE(governor.init(NULL, effective, GOV_NUM_TASKS, 0, 2, 50));
+    CHECK_FALSE(governor.init(limits, NULL, GOV_NUM_TASKS, 0, 2, 50));
+    CHECK_FALSE(governor.init(limits, effective, GOV_NUM_TASKS, 0, 0, 50));
+    CHECK_FALSE(governor.init(limits, effective, GOV_NUM_TASKS, 0, 2, 0));
+    CHECK_TRUE(governor.init(limits, effective, GOV_NUM_TASKS - 1, 0, 2, 50));
+    CHECK_FALSE(myScheduler.attachGovernor(&governor));     /* too short */
+
+    CHECK_TRUE(governor.init(limits, effective, GOV_NUM_TASKS, 0, 2, 50));
+    CHECK_TRUE(myScheduler.group(classes, GOV_NUM_TASKS, members));
+    CHECK_FALSE(myScheduler.attachGovernor(&governor));     /* grouped */
+
+    Scheduler bare;
+    CHECK_TRUE(bare.init(taskTable, GOV_NUM_TASKS, GOV_TICK_US));
+    CHECK_FALSE(bare.attachGovernor(&governor));            /* no extension */
+
+    CHECK_TRUE(myScheduler.init(taskTable, GOV_NUM_TASKS, GOV_TICK_US));
+    CHECK_TRUE(myScheduler.attachGovernor(&governor));
+    CHECK_FALSE(myScheduler.group(classes, GOV_NUM_TASKS, members));
+    CHECK_EQUAL(1, myScheduler.effectiveInterval(1));
+
+    CHECK_TRUE(myScheduler.init(badTable, 1, GOV_TICK_US));
+    CHECK_TRUE(badGovernor.init(badLimits, effective, 1, 0, 2, 50));
+    CHECK_FALSE(myScheduler.attachGovernor(&badGovernor));
+}
+
+/**
+ * @brief Critical-task lateness stays bounded as the optional load grows,
+ *        while without the governor every task slips
+ * 
+ */
+TEST(Governor_TestGroup, run_BoundsCriticalLateness)
+{
+    /* Optional load per tick: 0.4, 0.8, 1.2, 1.6 and 2.0 of a tick */
+    for( uint32_t cost = 100; cost <= 500; cost += 100 )
+    {
+        optional_cost_us = cost;
+
+        /* Without the governor */
+        setup();
+        simulate(GOV_SIM_TICKS);
+        const uint32_t slip_total = critical_late_total;
+
+        /* With the governor */
+        setup();
+        CHECK_TRUE(governor.init(limits, effective, GOV_NUM_TASKS, 0, 2, 50));
+        CHECK_TRUE(myScheduler.attachGovernor(&governor));
+        simulate(GOV_SIM_TICKS);
+
+        CHECK(critical_worst_late <= 1);
+        CHECK(critical_late_total * 10 <= critical_calls);  /* late on at most 1 in 10 ticks */
+        CHECK_EQUAL(1, myScheduler.effectiveInterval(0));
+        CHECK_EQUAL(0, myScheduler.effectiveInterval(GOV_NUM_TASKS));
+
+        if( cost * 4 + GOV_CRITICAL_COST_US > GOV_TICK_US )
+        {
+            /* Overloaded: the uniform slip grows, the least important tasks stretch first */
+            CHECK(slip_total > 0);
+            CHECK(myScheduler.effectiveInterval(3) >= myScheduler.effectiveInterval(1));
+            CHECK(myScheduler.effectiveInterval(3) > 1);
+        }
+        else
+        {
+            /* Not overloaded: nothing is stretched */
+            CHECK_EQUAL(0, slip_total);
+            CHECK_EQUAL(1, myScheduler.effectiveInterval(1));
+            CHECK_EQUAL(1, myScheduler.effectiveInterval(3));
+        }
+    }
+}
+
+/**
+ * @brief Stretched intervals return to nominal once the overload is gone
+ * 
+ */
+TEST(Governor_TestGroup, run_RestoresAfterOverload)
+{
+    CHECK_TRUE(governor.init(limits, effective, GOV_NUM_TASKS, 0, 2, 50));
+    CHECK_TRUE(myScheduler.attachGovernor(&governor));
+
+    optional_cost_us = 400;
+    simulate(2000);
+    CHECK(myScheduler.effectiveInterval(3) > 1);
+
+    optional_cost_us = 50;
+    simulate(3000);
+    critical_worst_late = 0;
+    simulate(4000);
+    for( uint16_t i = 0; i < GOV_NUM_TASKS; ++i )
+    {
+        CHECK_EQUAL(1, myScheduler.effectiveInterval(i));
+    }
+    CHECK_EQUAL(0, critical_worst_late);
+}
+
+/**
+ * @brief A restored task runs on the very next pass, not a tick late
+ *        (lateness that would stretch it straight back)
+ * 
+ */
+TEST(Governor_TestGroup, run_RestoreIsNotLate)
+{
+    Scheduler::Task table[2] = {
+        {optionalTask, 1},
+        {optionalTask, 4}
+    };
+    const Scheduler::Limits bounds[2] = {
+        {0, 0, 0},
+        {1, 4, 64}
+    };
+    uint32_t eff[2];
+
+    optional_cost_us = 0;
+    CHECK_TRUE(myScheduler.init(table, 2, GOV_TICK_US));
+    CHECK_TRUE(governor.init(bounds, eff, 2, 0, 1, 1));
+    CHECK_TRUE(myScheduler.attachGovernor(&governor));
+
+    /* Overload: every pass finds the fixed rate task late */
+    for( int t = 0; t < 16; ++t )
+    {
+        myScheduler.tick();
+        myScheduler.tick();
+        myScheduler.tick();
+        myScheduler.run();
+    }
+    CHECK_EQUAL(64, myScheduler.effectiveInterval(1));
+
+    /* Calm: the interval only ever halves, down to its nominal value */
+    uint32_t last = 64;
+    for( int t = 0; t < 64; ++t )
+    {
+        myScheduler.tick();
+        myScheduler.run();
+        myScheduler.run();
+
+        const uint32_t e = myScheduler.effectiveInterval(1);
+        CHECK(e <= last);
+        last = e;
+    }
+    CHECK_EQUAL(4, last);
+}
@@ -64,6 +64,7 @@ TEST_GROUP(Lean_Scheduler_TestGroup)
 
     /* Instance Declaration */
     Scheduler myScheduler;
+    Scheduler::Extension ext;   /*!< Storage for the optional features, see extend() */
     
     void setup()
     {
@@ -208,6 +209,55 @@ TEST(Lean_Scheduler_TestGroup, run_Continuous)
 
 }
 
+/**
+ * @brief   Test that an interval set to 0 at run time makes a task
+ *          continuous, and that setting it back stops it
+ * 
+ */
+TEST(Lean_Scheduler_TestGroup, run_SetInterval)
+{
+    const uint8_t expect_calls = 10;
+
+    /* Build sample task table */
+    Scheduler::Task taskTable_setInterval[TEST_NUM_TASKS_1] = {
+        {task1, 1},     /*!< 1: Run synchronous with systick */
+    };
+    static const Scheduler::TaskDef taskDefs[TEST_NUM_TASKS_1] = {
+        {task1, 1}
+    };
+    Scheduler::TaskState taskStates[TEST_NUM_TASKS_1];
+
+    /* Test 1: Edge conditions */
+    CHECK_TRUE(myScheduler.init(taskDefs, taskStates, TEST_NUM_TASKS_1, SYSTICK_INTERVAL_10mS));
+    CHECK_FALSE(myScheduler.setInterval(0, 0));     /* const table */
+    CHECK_TRUE(myScheduler.init(taskTable_setInterval, TEST_NUM_TASKS_1, SYSTICK_INTERVAL_10mS));
+    CHECK_FALSE(myScheduler.setInterval(TEST_NUM_TASKS_1, 0));
+
+    /* First pass runs the task */
+    mock().expectOneCall("task1");
+    myScheduler.run();
+    mock().checkExpectations();
+    mock().clear();
+
+    /* Test 2: Continuous without a tick */
+    CHECK_TRUE(myScheduler.setInterval(0, 0));
+    mock().expectNCalls(expect_calls, "task1");
+    for( size_t i = 0; i < expect_calls; ++i){
+        myScheduler.run();
+    }
+    mock().checkExpectations();
+    mock().clear();
+
+    /* Test 3: Back to once per systick */
+    CHECK_TRUE(myScheduler.setInterval(0, 1));
+    mock().expectNoCall("task1");
+    for( size_t i = 0; i < expect_calls; ++i){
+        myScheduler.run();
+    }
+    mock().checkExpectations();
+    mock().clear();
+}
+
 /**
  * @brief   Test that a task registered for one systick
  *          actually runs for every one systick only
@@ -549,6 +599,600 @@ TEST(Lean_Scheduler_TestGroup, run_ThreeTasks_DifferentIntervals)
 
 }
 
+/**
+ * @brief   Test that notify() wakes an event-driven task once,
+ *          and that such a task never becomes due on ticks alone
+ * 
+ */
+TEST(Lean_Scheduler_TestGroup, run_EventDriven)
+{
+    /* Build sample task table */
+    Scheduler::Task taskTable_runEventDriven[TEST_NUM_TASKS_2] = {
+        {task1, Scheduler::EVENT_DRIVEN},   /*!< runs only when notified */
+        {task2, 1}                          /*!< 1: once per systick */
+    };
+
+    /* Reinitialize object for this specific test */
+    myScheduler.init(taskTable_runEventDriven, 
+                    TEST_NUM_TASKS_2, 
+                    SYSTICK_INTERVAL_10mS
+                    );
+
+    /* Test 1: Out of range index is rejected */
+    CHECK_FALSE(myScheduler.notify(TEST_NUM_TASKS_2));
+
+    /* Test 2: Event-driven task is not called on the first pass */
+    mock().expectNoCall("task1");
+    mock().expectOneCall("task2");
+    myScheduler.run();
+    mock().checkExpectations();
+    mock().clear();
+
+    /* Test 3: Many ticks, still no call without a notify */
+    mock().expectNoCall("task1");
+    mock().expectOneCall("task2");
+    for( int i = 0; i < 1000; ++i )
+    {
+        (void)myScheduler.tick();
+    }
+    myScheduler.run();
+    mock().checkExpectations();
+    mock().clear();
+
+    /* Test 4: Notify wakes it exactly once, without a tick */
+    mock().expectOneCall("task1");
+    mock().expectNoCall("task2");
+    CHECK_TRUE(myScheduler.notify(0));
+    myScheduler.run();
+    myScheduler.run();
+    mock().checkExpectations();
+    mock().clear();
+
+    /* Test 5: Repeated notifies before a pass coalesce into one call */
+    mock().expectOneCall("task1");
+    (void)myScheduler.notify(0);
+    (void)myScheduler.notify(0);
+    myScheduler.run();
+    mock().checkExpectations();
+    mock().clear();
+}
+
+/**
+ * @brief   Test that waking a periodic task runs it early
+ *          without shifting its periodic phase
+ * 
+ */
+TEST(Lean_Scheduler_TestGroup, run_NotifyKeepsPhase)
+{
+    /* Build sample task table */
+    Scheduler::Task taskTable_runNotify[TEST_NUM_TASKS_1] = {
+        {task3, 5}      /*!< 5: Run every 5 sys ticks */
+    };
+
+    /* Reinitialize object for this specific test */
+    myScheduler.init(taskTable_runNotify, 
+                    TEST_NUM_TASKS_1, 
+                    SYSTICK_INTERVAL_10mS
+                    );
+
+    /* Test 1: First pass at tick 0 */
+    mock().expectOneCall("task3");
+    myScheduler.run();
+    mock().checkExpectations();
+    mock().clear();
+
+    /* Test 2: Woken at tick 2 */
+    mock().expectOneCall("task3");
+    (void)myScheduler.tick();
+    (void)myScheduler.tick();
+    (void)myScheduler.notify(0);
+    myScheduler.run();
+    mock().checkExpectations();
+    mock().clear();
+
+    /* Test 3: Still due at tick 5, as if never woken */
+    mock().expectNoCall("task3");
+    (void)myScheduler.tick();
+    (void)myScheduler.tick();
+    myScheduler.run();
+    mock().checkExpectations();
+    mock().clear();
+
+    mock().expectOneCall("task3");
+    (void)myScheduler.tick();
+    myScheduler.run();
+    mock().checkExpectations();
+    mock().clear();
+}
+
+/**
+ * @brief   Test that an 8-bit scheduler keeps its intervals across
+ *          the wraparound of the tick counter
+ * 
+ */
+TEST(Lean_Scheduler_TestGroup, run_TickWidth8_Wraparound)
+{
+    BasicScheduler<uint8_t> sch8;
+
+    /* Build sample task table */
+    BasicScheduler<uint8_t>::Task taskTable_8bit[TEST_NUM_TASKS_2] = {
+        {task1, 1},     /*!< 1: once per systick */
+        {task3, 100}    /*!< 100: every 100 sys ticks */
+    };
+    CHECK_TRUE(sch8.init(taskTable_8bit, TEST_NUM_TASKS_2, SYSTICK_INTERVAL_10mS));
+
+    /* Three full wraps of the 8-bit counter */
+    for( uint32_t ctr = 0; ctr < 3 * 256; ++ctr )
+    {
+        mock().expectOneCall("task1");
+        if( 0 == ctr % 100 )
+        {
+            mock().expectOneCall("task3");
+        }
+        else
+        {
+            mock().expectNoCall("task3");
+        }
+
+        sch8.run();
+        mock().checkExpectations();
+        mock().clear();
+
+        CHECK_EQUAL((uint8_t)( ctr + 1 ), sch8.tick());
+    }
+}
+
+/**
+ * @brief   Test that the const/flash table layout schedules the same
+ *          way as the RAM layout, and that notify() reaches its states
+ * 
+ */
+TEST(Lean_Scheduler_TestGroup, run_ConstTable)
+{
+    static const Scheduler::TaskDef taskDefs[TEST_NUM_TASKS_3] = {
+        {task1, 1},                         /*!< 1: once per systick */
+        {task2, 5},                         /*!< 5: every 5 sys ticks */
+        {task3, Scheduler::EVENT_DRIVEN}    /*!< runs only when notified */
+    };
+    Scheduler::TaskState taskStates[TEST_NUM_TASKS_3];
+
+    /* Test 1: Edge conditions */
+    CHECK_FALSE(myScheduler.init(NULL, taskStates, TEST_NUM_TASKS_3, SYSTICK_INTERVAL_10mS));
+    CHECK_FALSE(myScheduler.init(taskDefs, NULL, TEST_NUM_TASKS_3, SYSTICK_INTERVAL_10mS));
+    CHECK_TRUE(myScheduler.init(taskDefs, taskStates, TEST_NUM_TASKS_3, SYSTICK_INTERVAL_10mS));
+
+    /* Test 2: Periodic tasks over 20 ticks */
+    for( uint32_t ctr = 0; ctr < 20; ++ctr )
+    {
+        mock().expectOneCall("task1");
+        if( 0 == ctr % 5 )
+        {
+            mock().expectOneCall("task2");
+        }
+        else
+        {
+            mock().expectNoCall("task2");
+        }
+        mock().expectNoCall("task3");
+
+        myScheduler.run();
+        mock().checkExpectations();
+        mock().clear();
+
+        myScheduler.tick();
+    }
+
+    /* Test 3: Event-driven task from the const table */
+    mock().expectOneCall("task1");
+    mock().expectOneCall("task2");  /* tick 20 */
+    myScheduler.run();
+    mock().checkExpectations();
+    mock().clear();
+
+    mock().expectOneCall("task3");
+    mock().expectNoCall("task1");
+    mock().expectNoCall("task2");
+    CHECK_TRUE(myScheduler.notify(2));
+    myScheduler.run();
+    mock().checkExpectations();
+    mock().clear();
+}
+
+/**
+ * @brief   Test that grouping tasks into period classes keeps the
+ *          schedule of the individual checks
+ * 
+ */
+TEST(Lean_Scheduler_TestGroup, run_Grouped)
+{
+    /* Build sample task table */
+    Scheduler::Task taskTable_runGrouped[TEST_NUM_TASKS_4] = {
+        {task1, 5},     /*!< 5: every 5 sys ticks */
+        {task2, 0},     /*!< 0: continuous task */
+        {task3, 5},     /*!< 5: same class as task1 */
+        {task4, 100}    /*!< 100: every 100 ticks */
+    };
+    Scheduler::PeriodClass classes[3];
+    uint16_t members[TEST_NUM_TASKS_4];
+
+    /* Reinitialize object for this specific test */
+    myScheduler.init(taskTable_runGrouped, 
+                    TEST_NUM_TASKS_4, 
+                    SYSTICK_INTERVAL_10mS
+                    );
+
+    /* Test 1: Edge conditions */
+    CHECK_FALSE(myScheduler.group(classes, 3, members));   /* no extension */
+    CHECK_FALSE(myScheduler.extend(NULL));
+    CHECK_TRUE(myScheduler.extend(&ext));
+    CHECK_FALSE(myScheduler.group(NULL, 3, members));
+    CHECK_FALSE(myScheduler.group(classes, 3, NULL));
+    CHECK_FALSE(myScheduler.group(classes, 2, members));   /* three classes needed */
+    CHECK_TRUE(myScheduler.group(classes, 3, members));
+
+    /* Test 2: Same calls as the individual checks over 250 ticks */
+    for( uint32_t ctr = 0; ctr < 250; ++ctr )
+    {
+        mock().expectOneCall("task2");
+        if( 0 == ctr % 5 )
+        {
+            mock().expectOneCall("task1");
+            mock().expectOneCall("task3");
+        }
+        else
+        {
+            mock().expectNoCall("task1");
+            mock().expectNoCall("task3");
+        }
+        if( 0 == ctr % 100 )
+        {
+            mock().expectOneCall("task4");
+        }
+        else
+        {
+            mock().expectNoCall("task4");
+        }
+
+        myScheduler.run();
+        mock().checkExpectations();
+        mock().clear();
+
+        myScheduler.tick();
+    }
+
+    /* Test 3: A woken member runs alone when its class is not due (tick 251) */
+    mock().expectOneCall("task1");
+    mock().expectOneCall("task2");
+    mock().expectOneCall("task3");
+    myScheduler.run();
+    mock().checkExpectations();
+    mock().clear();
+
+    myScheduler.tick();
+    mock().expectOneCall("task2");
+    mock().expectOneCall("task4");
+    mock().expectNoCall("task1");
+    mock().expectNoCall("task3");
+    CHECK_TRUE(myScheduler.notify(3));
+    myScheduler.run();
+    mock().checkExpectations();
+    mock().clear();
+
+    /* Test 4: Regrouping keeps the phase: task4 next due at tick 300 */
+    CHECK_TRUE(myScheduler.group(classes, 3, members));
+    for( uint32_t ctr = 252; ctr <= 300; ++ctr )
+    {
+        myScheduler.tick();
+        mock().expectOneCall("task2");
+        mock().expectNCalls(( 0 == ctr % 5 ) ? 1 : 0, "task1");
+        mock().expectNCalls(( 0 == ctr % 5 ) ? 1 : 0, "task3");
+        mock().expectNCalls(( 300 == ctr ) ? 1 : 0, "task4");
+        myScheduler.run();
+        mock().checkExpectations();
+        mock().clear();
+    }
+}
+
+/**
+ * @brief Nested scheduler runs at the divided rate and wakes on notify
+ * 
+ */
+TEST(Lean_Scheduler_TestGroup, run_Hierarchical)
+{
+    Scheduler::Task parentTable[TEST_NUM_TASKS_1] = {
+        {task1, 1}      /*!< 1: every parent tick */
+    };
+    Scheduler::Task childTable[TEST_NUM_TASKS_2] = {
+        {task3, 1},                         /*!< 1: every child tick */
+        {task4, Scheduler::EVENT_DRIVEN}    /*!< only when notified */
+    };
+    Scheduler parent;
+    Scheduler child;
+    Scheduler other;
+    Scheduler::Extension parentExt;
+    Scheduler::Extension childExt;
+    Scheduler::Extension otherExt;
+
+    CHECK_TRUE(parent.init(parentTable, TEST_NUM_TASKS_1, SYSTICK_INTERVAL_10mS));
+    CHECK_TRUE(child.init(childTable, TEST_NUM_TASKS_2, 5 * SYSTICK_INTERVAL_10mS));
+    CHECK_TRUE(other.init(parentTable, TEST_NUM_TASKS_1, SYSTICK_INTERVAL_10mS));
+    CHECK_TRUE(parent.extend(&parentExt));
+    CHECK_TRUE(other.extend(&otherExt));
+
+    /* Test 1: Edge conditions */
+    CHECK_FALSE(parent.attachChild(&child, 5));    /* child not extended */
+    CHECK_TRUE(child.extend(&childExt));
+    CHECK_FALSE(parent.attachChild(NULL, 5));
+    CHECK_FALSE(parent.attachChild(&child, 0));
+    CHECK_FALSE(parent.attachChild(&parent, 5));
+    CHECK_TRUE(parent.attachChild(&child, 5));
+    CHECK_FALSE(other.attachChild(&child, 5));     /* already nested */
+    CHECK_FALSE(child.attachChild(&parent, 5));    /* cycle */
+    CHECK_FALSE(child.extend(&otherExt));          /* nested */
+
+    /* Test 2: Child released every 5 parent ticks, one child tick each */
+    for( uint32_t ctr = 0; ctr <= 50; ++ctr )
+    {
+        mock().expectOneCall("task1");
+        mock().expectNCalls(( 0 == ctr % 5 ) ? 1 : 0, "task3");
+        mock().expectNoCall("task4");
+
+        parent.run();
+        mock().checkExpectations();
+        mock().clear();
+
+        parent.tick();
+    }
+    CHECK_EQUAL(11, child.getTickCount());
+
+    /* Test 3: A notify on the child releases it on the next parent pass (tick 51) */
+    CHECK_TRUE(child.notify(1));
+    mock().expectOneCall("task1");
+    mock().expectOneCall("task4");
+    mock().expectNoCall("task3");
+    parent.run();
+    mock().checkExpectations();
+    mock().clear();
+    CHECK_EQUAL(11, child.getTickCount());
+
+    /* Test 4: Late parent pass releases the missed child ticks at once (tick 62) */
+    for( uint32_t i = 0; i < 11; ++i ) parent.tick();
+    mock().expectOneCall("task1");
+    mock().expectOneCall("task3");
+    parent.run();
+    mock().checkExpectations();
+    mock().clear();
+    CHECK_EQUAL(13, child.getTickCount());
+
+    /* Test 5: Reinitializing the parent detaches the child */
+    CHECK_TRUE(parent.init(parentTable, TEST_NUM_TASKS_1, SYSTICK_INTERVAL_10mS));
+    mock().expectOneCall("task1");
+    mock().expectNoCall("task3");
+    parent.run();
+    mock().checkExpectations();
+    mock().clear();
+    CHECK_TRUE(other.attachChild(&child, 5));
+}
+
+/**
+ * @brief Independent time bases run only when their own counter advanced
+ * 
+ */
+TEST(Lean_Scheduler_TestGroup, run_TimeBases)
+{
+    Scheduler::Task fastTable[TEST_NUM_TASKS_1] = {
+        {task1, 1}      /*!< 1: every fast tick */
+    };
+    Scheduler::Task slowTable[TEST_NUM_TASKS_2] = {
+        {task3, 1},                         /*!< 1: every slow tick */
+        {task4, Scheduler::EVENT_DRIVEN}    /*!< only when notified */
+    };
+    Scheduler fast;
+    Scheduler slow;
+    Scheduler::Extension fastExt;
+    Scheduler::Extension slowExt;
+
+    CHECK_TRUE(fast.init(fastTable, TEST_NUM_TASKS_1, 100U));
+    CHECK_TRUE(slow.init(slowTable, TEST_NUM_TASKS_2, SYSTICK_INTERVAL_10mS));
+    CHECK_TRUE(fast.extend(&fastExt));
+    CHECK_TRUE(slow.extend(&slowExt));
+
+    /* Test 1: Edge conditions */
+    CHECK_FALSE(fast.attachTimeBase(NULL));
+    CHECK_FALSE(fast.attachTimeBase(&fast));
+    CHECK_TRUE(fast.attachTimeBase(&slow));
+    CHECK_FALSE(fast.attachTimeBase(&slow));
+
+    /* Test 2: Both time bases run on the first pass */
+    mock().expectOneCall("task1");
+    mock().expectOneCall("task3");
+    fast.run();
+    mock().checkExpectations();
+    mock().clear();
+
+    /* Test 3: Passes without a tick run nothing */
+    mock().expectNoCall("task1");
+    mock().expectNoCall("task3");
+    fast.run();
+    fast.run();
+    mock().checkExpectations();
+    mock().clear();
+
+    /* Test 4: Each time base runs on its own ticks only */
+    for( uint32_t ctr = 1; ctr <= 300; ++ctr )
+    {
+        fast.tick();
+        if( 0 == ctr % 100 ) slow.tick();
+
+        mock().expectOneCall("task1");
+        mock().expectNCalls(( 0 == ctr % 100 ) ? 1 : 0, "task3");
+        mock().expectNoCall("task4");
+        fast.run();
+        mock().checkExpectations();
+        mock().clear();
+    }
+    CHECK_EQUAL(300, fast.getTickCount());
+    CHECK_EQUAL(3, slow.getTickCount());
+
+    /* Test 5: A notify on the slow time base runs it without a tick */
+    CHECK_TRUE(slow.notify(1));
+    mock().expectOneCall("task4");
+    mock().expectNoCall("task1");
+    mock().expectNoCall("task3");
+    fast.run();
+    mock().checkExpectations();
+    mock().clear();
+}
+
+/**
+ * @brief Mode switches keep the phase of tasks that stay active
+ *        and release nothing spuriously
+ * 
+ */
+TEST(Lean_Scheduler_TestGroup, run_Modes)
+{
+    enum { MODE_NORMAL, MODE_DEGRADED, MODE_LOW_POWER, NUM_MODES };
+
+    Scheduler::Task taskTable_runModes[TEST_NUM_TASKS_4] = {
+        {task1, 5},
+        {task2, 1},
+        {task3, 10},
+        {task4, Scheduler::EVENT_DRIVEN}
+    };
+    static const Scheduler::ModeEntry normal[] = {
+        {0, 5}, {1, 1}, {2, 10}
+    };
+    static const Scheduler::ModeEntry degraded[] = {
+        {0, 5}, {2, 20}, {3, Scheduler::EVENT_DRIVEN}
+    };
+    static const Scheduler::ModeEntry low_power[] = {
+        {2, 50}
+    };
+    static const Scheduler::ModeEntry bad[] = {
+        {TEST_NUM_TASKS_4, 5}
+    };
+    static const Scheduler::Mode modes[NUM_MODES] = {
+        {"normal", normal, 3},
+        {"degraded", degraded, 3},
+        {"low power", low_power, 1}
+    };
+    static const Scheduler::Mode bad_modes[1] = {
+        {"bad", bad, 1}
+    };
+    Scheduler::PeriodClass classes[TEST_NUM_TASKS_4];
+    uint16_t members[TEST_NUM_TASKS_4];
+
+    myScheduler.init(taskTable_runModes, TEST_NUM_TASKS_4, SYSTICK_INTERVAL_10mS);
+
+    /* Test 1: Edge conditions */
+    CHECK_FALSE(myScheduler.initModes(modes, NUM_MODES));  /* no extension */
+    CHECK_TRUE(myScheduler.extend(&ext));
+    CHECK_FALSE(myScheduler.requestMode(MODE_NORMAL));
+    CHECK_FALSE(myScheduler.initModes(NULL, NUM_MODES));
+    CHECK_FALSE(myScheduler.initModes(modes, 0));
+    CHECK_FALSE(myScheduler.initModes(bad_modes, 1));
+    CHECK_TRUE(myScheduler.initModes(modes, NUM_MODES));
+    CHECK_FALSE(myScheduler.requestMode(NUM_MODES));
+    CHECK_FALSE(myScheduler.group(classes, TEST_NUM_TASKS_4, members));
+    CHECK_EQUAL(MODE_NORMAL, myScheduler.currentMode());
+    STRCMP_EQUAL("normal", modes[myScheduler.currentMode()].name);
+    CHECK_EQUAL(10, myScheduler.effectiveInterval(2));
+    CHECK_EQUAL(Scheduler::EVENT_DRIVEN, myScheduler.effectiveInterval(3));
+    CHECK_EQUAL(0, myScheduler.effectiveInterval(TEST_NUM_TASKS_4));
+
+    /* Expected number of calls of each task in the next pass */
+    auto expectCalls = [](const unsigned n1, const unsigned n2, const unsigned n3, const unsigned n4)
+    {
+        mock().expectNCalls(n1, "task1");
+        mock().expectNCalls(n2, "task2");
+        mock().expectNCalls(n3, "task3");
+        mock().expectNCalls(n4, "task4");
+    };
+
+    /* Test 2: Normal mode, ticks 0 to 12 */
+    for( uint32_t ctr = 0; ctr <= 12; ++ctr )
+    {
+        if( ctr != 0 ) myScheduler.tick();
+        expectCalls(( 0 == ctr % 5 ) ? 1 : 0, 1, ( 0 == ctr % 10 ) ? 1 : 0, 0);
+        myScheduler.run();
+        mock().checkExpectations();
+        mock().clear();
+    }
+
+    /* Test 3: Degraded from tick 13: task1 keeps its phase (15, 20, ...),
+     * task3 slows down to 20 from its last run at 10, task4 is held until notified
+     */
+    CHECK_TRUE(myScheduler.requestMode(MODE_DEGRADED));
+    for( uint32_t ctr = 13; ctr <= 31; ++ctr )
+    {
+        myScheduler.tick();
+        if( 21 == ctr ) CHECK_TRUE(myScheduler.notify(3));
+        expectCalls(( 0 == ctr % 5 ) ? 1 : 0, 0, ( 30 == ctr ) ? 1 : 0, ( 21 == ctr ) ? 1 : 0);
+        myScheduler.run();
+        mock().checkExpectations();
+        mock().clear();
+        CHECK_EQUAL(MODE_DEGRADED, myScheduler.currentMode());
+    }
+
+    /* Test 4: Low power from tick 32: only task3, next due at 30 + 50.
+     * A wake-up for a task outside the mode is held.
+     */
+    CHECK_TRUE(myScheduler.requestMode(MODE_LOW_POWER));
+    for( uint32_t ctr = 32; ctr <= 80; ++ctr )
+    {
+        myScheduler.tick();
+        if( 40 == ctr ) CHECK_TRUE(myScheduler.notify(3));
+        expectCalls(0, 0, ( 80 == ctr ) ? 1 : 0, 0);
+        myScheduler.run();
+        mock().checkExpectations();
+        mock().clear();
+    }
+
+    /* Test 5: Back to degraded at tick 81: task1 overdue since 30 runs once,
+     * the held wake-up of task4 is delivered, task3 waits for 80 + 20
+     */
+    CHECK_TRUE(myScheduler.requestMode(MODE_DEGRADED));
+    myScheduler.tick();
+    expectCalls(1, 0, 0, 1);
+    myScheduler.run();
+    mock().checkExpectations();
+    mock().clear();
+    for( uint32_t ctr = 82; ctr <= 100; ++ctr )
+    {
+        myScheduler.tick();
+        expectCalls(( 86 == ctr || 91 == ctr || 96 == ctr ) ? 1 : 0, 0, ( 100 == ctr ) ? 1 : 0, 0);
+        myScheduler.run();
+        mock().checkExpectations();
+        mock().clear();
+    }
+    CHECK_EQUAL(20, myScheduler.effectiveInterval(2));
+
+    /* Test 6: The first release follows the mode intervals, not the table's:
+     * both tasks run at tick 0, then every 10 ticks
+     */
+    Scheduler::Task taskTable_firstRelease[TEST_NUM_TASKS_2] = {
+        {task1, 1},
+        {task2, 0}
+    };
+    static const Scheduler::ModeEntry slow[] = {
+        {0, 10}, {1, 10}
+    };
+    static const Scheduler::Mode slow_modes[1] = {
+        {"slow", slow, 2}
+    };
+
+    myScheduler.init(taskTable_firstRelease, TEST_NUM_TASKS_2, SYSTICK_INTERVAL_10mS);
+    CHECK_TRUE(myScheduler.initModes(slow_modes, 1));
+    for( uint32_t ctr = 0; ctr <= 20; ++ctr )
+    {
+        if( ctr != 0 ) myScheduler.tick();
+        expectCalls(( 0 == ctr % 10 ) ? 1 : 0, ( 0 == ctr % 10 ) ? 1 : 0, 0, 0);
+        myScheduler.run();
+        mock().checkExpectations();
+        mock().clear();
+    }
+}
+
 /* 
  * Mock Task definitions for Testing
  */
@@ -0,0 +1,506 @@
+/**
+ * @file test_Recorder.cpp
+ * @author Niel Cansino (nielcansino@gmail.com)
+ * @brief Test stub for the record/replay log
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ */
+
+#include "CppUTest/TestHarness.h"
+#include "Scheduler.hpp"
+#include "Recorder.hpp"
+
+#define REC_NUM_TASKS (3)
+#define TEST_REC_ONE_TASK (1)
+#define REC_RING_SIZE (1024U)
+#define REC_TRACE_MAX (512U)
+#define SYSTICK_INTERVAL_10mS (10000U) /* duration of a systick, in us */
+
+/**
+ * Call trace shared by the tasks, compared between recording and replay
+ */
+static uint8_t trace[REC_TRACE_MAX];
+static uint32_t trace_len = 0;
+static Scheduler* isr_target = NULL;    /* ticked from inside fastTask while recording */
+static uint32_t fast_calls = 0;
+
+static void traceCall(const uint8_t id)
+{
+    if( trace_len < REC_TRACE_MAX ) trace[trace_len++] = id;
+}
+
+static void fastTask(void)
+{
+    traceCall(0);
+
+    /* Simulate the tick ISR firing in the middle of a pass */
+    if( isr_target != NULL && ( ++fast_calls % 3 ) == 0 ) (void)isr_target->tick();
+}
+
+static void slowTask(void)
+{
+    traceCall(1);
+}
+
+static void eventTask(void)
+{
+    traceCall(2);
+}
+
+static void burstTask(void)
+{
+    traceCall(3);
+
+    /* Overruns every other call: two ticks arrive before the pass ends */
+    if( isr_target != NULL && ( ++fast_calls % 2 ) == 0 )
+    {
+        (void)isr_target->tick();
+        (void)isr_target->tick();
+    }
+}
+
+/**
+ * @brief Test group for Recorder
+ * 
+ */
+TEST_GROUP(Recorder_TestGroup)
+{
+    /* Build sample task table */
+    Scheduler::Task taskTable[REC_NUM_TASKS] = {
+        {fastTask, 1},                      /*!< 1: every tick */
+        {slowTask, 3},                      /*!< 3: every 3 ticks */
+        {eventTask, Scheduler::EVENT_DRIVEN}
+    };
+
+    uint8_t ring[REC_RING_SIZE];
+    uint8_t log[REC_RING_SIZE];
+    uint32_t log_len;
+    Recorder recorder;
+    Scheduler myScheduler;
+    Scheduler::Extension ext;
+
+    void setup()
+    {
+        trace_len = 0;
+        fast_calls = 0;
+        isr_target = NULL;
+        log_len = 0;
+        (void)myScheduler.init(taskTable, REC_NUM_TASKS, SYSTICK_INTERVAL_10mS);
+        (void)myScheduler.extend(&ext);
+    }
+
+    /* Irregular interleaving of ticks, passes, mid-pass ticks and wake-ups */
+    void recordSession(void)
+    {
+        isr_target = &myScheduler;
+        for( uint32_t i = 0; i < 60; ++i )
+        {
+            if( i % 4 != 3 ) (void)myScheduler.tick();
+            if( i % 7 == 0 ) (void)myScheduler.notify(2);
+            if( i % 11 == 0 ) (void)myScheduler.notify(1);
+            myScheduler.run();
+
+            log_len += recorder.drain(&log[log_len], REC_RING_SIZE - log_len);
+        }
+        isr_target = NULL;
+    }
+};
+
+/**
+ * @brief Edge conditions on init and initReplay
+ * 
+ */
+TEST(Recorder_TestGroup, init_EdgeConditions)
+{
+    CHECK_FALSE(recorder.init(NULL, REC_RING_SIZE));
+    CHECK_FALSE(recorder.init(ring, 100));     /* not a power of two */
+    CHECK_FALSE(recorder.init(ring, 8));       /* below one record */
+    CHECK_TRUE(recorder.init(ring, REC_RING_SIZE));
+
+    const uint8_t garbage[2] = {0x00, 0x00};
+    CHECK_FALSE(recorder.initReplay(NULL, 2));
+    CHECK_FALSE(recorder.initReplay(garbage, 2));
+}
+
+/**
+ * @brief A replayed session makes the same calls in the same order,
+ *        including ticks that arrived in the middle of a pass
+ * 
+ */
+TEST(Recorder_TestGroup, replay_Reproduces)
+{
+    CHECK_TRUE(recorder.init(ring, REC_RING_SIZE));
+    CHECK_TRUE(myScheduler.attachRecorder(&recorder));
+    recordSession();
+    CHECK_FALSE(recorder.overflowed());
+
+    uint8_t recorded[REC_TRACE_MAX];
+    const uint32_t recorded_len = trace_len;
+    for( uint32_t i = 0; i < trace_len; ++i ) recorded[i] = trace[i];
+
+    /* Replay into a fresh scheduler with the same table */
+    Scheduler replayed;
+    Scheduler::Extension replayedExt;
+    Recorder player;
+    (void)replayed.init(taskTable, REC_NUM_TASKS, SYSTICK_INTERVAL_10mS);
+    (void)replayed.extend(&replayedExt);
+    CHECK_TRUE(player.initReplay(log, log_len));
+    CHECK_TRUE(replayed.attachRecorder(&player));
+
+    trace_len = 0;
+    CHECK_EQUAL(0, replay(replayed, player));
+
+    CHECK_EQUAL(recorded_len, trace_len);
+    for( uint32_t i = 0; i < trace_len; ++i )
+    {
+        CHECK_EQUAL(recorded[i], trace[i]);
+    }
+    CHECK_EQUAL(myScheduler.getTickCount(), replayed.getTickCount());
+}
+
+/**
+ * @brief Small values take one byte: PASS and DISPATCH one each, TICK two
+ * 
+ */
+TEST(Recorder_TestGroup, record_Compact)
+{
+    Scheduler::Task fastTable[TEST_REC_ONE_TASK] = {
+        {slowTask, 1}
+    };
+    (void)myScheduler.init(fastTable, TEST_REC_ONE_TASK, SYSTICK_INTERVAL_10mS);
+
+    CHECK_TRUE(recorder.init(ring, REC_RING_SIZE));
+    CHECK_TRUE(myScheduler.attachRecorder(&recorder));
+
+    for( uint32_t i = 0; i < 10; ++i )
+    {
+        (void)myScheduler.tick();
+        myScheduler.run();
+    }
+
+    /* START (2 bytes), then 10 x (PASS + TICK + DISPATCH) */
+    CHECK_EQUAL(2 + 10 * 4, recorder.drain(log, REC_RING_SIZE));
+}
+
+/**
+ * @brief A full ring stops recording, and what was kept still replays
+ * 
+ */
+TEST(Recorder_TestGroup, overflow_KeepsPrefix)
+{
+    CHECK_TRUE(recorder.init(ring, 32));
+    CHECK_TRUE(myScheduler.attachRecorder(&recorder));
+
+    /* Nobody drains: the ring fills up */
+    for( uint32_t i = 0; i < 20; ++i )
+    {
+        (void)myScheduler.tick();
+        myScheduler.run();
+    }
+    CHECK_TRUE(recorder.overflowed());
+
+    log_len = recorder.drain(log, REC_RING_SIZE);
+    CHECK(log_len > 0 && log_len <= 32);
+
+    Scheduler replayed;
+    Scheduler::Extension replayedExt;
+    Recorder player;
+    (void)replayed.init(taskTable, REC_NUM_TASKS, SYSTICK_INTERVAL_10mS);
+    (void)replayed.extend(&replayedExt);
+    CHECK_TRUE(player.initReplay(log, log_len));
+    CHECK_TRUE(replayed.attachRecorder(&player));
+    CHECK_EQUAL(0, replay(replayed, player));
+}
+
+/**
+ * @brief Replaying with a different table is reported as divergence
+ * 
+ */
+TEST(Recorder_TestGroup, replay_DetectsDivergence)
+{
+    CHECK_TRUE(recorder.init(ring, REC_RING_SIZE));
+    CHECK_TRUE(myScheduler.attachRecorder(&recorder));
+    recordSession();
+
+    Scheduler::Task otherTable[REC_NUM_TASKS] = {
+        {fastTask, 1},
+        {slowTask, 4},                      /*!< 4 instead of 3 */
+        {eventTask, Scheduler::EVENT_DRIVEN}
+    };
+    Scheduler replayed;
+    Scheduler::Extension replayedExt;
+    Recorder player;
+    (void)replayed.init(otherTable, REC_NUM_TASKS, SYSTICK_INTERVAL_10mS);
+    (void)replayed.extend(&replayedExt);
+    CHECK_TRUE(player.initReplay(log, log_len));
+    CHECK_TRUE(replayed.attachRecorder(&player));
+    CHECK(replay(replayed, player) > 0);
+}
+
+/**
+ * @brief Mode switches are logged and replayed at the same pass
+ * 
+ */
+TEST(Recorder_TestGroup, replay_ModeSwitches)
+{
+    static const Scheduler::ModeEntry all[] = {
+        {0, 1}, {1, 3}, {2, Scheduler::EVENT_DRIVEN}
+    };
+    static const Scheduler::ModeEntry reduced[] = {
+        {1, 2}, {2, Scheduler::EVENT_DRIVEN}
+    };
+    static const Scheduler::Mode modes[2] = {
+        {"all", all, 3},
+        {"reduced", reduced, 2}
+    };
+
+    CHECK_TRUE(myScheduler.initModes(modes, 2));
+    CHECK_TRUE(recorder.init(ring, REC_RING_SIZE));
+    CHECK_TRUE(myScheduler.attachRecorder(&recorder));
+
+    for( uint32_t i = 0; i < 60; ++i )
+    {
+        if( i % 4 != 3 ) (void)myScheduler.tick();
+        if( i % 7 == 0 ) (void)myScheduler.notify(2);
+        if( i % 9 == 0 ) (void)myScheduler.requestMode(( i / 9 ) % 2);
+        myScheduler.run();
+
+        log_len += recorder.drain(&log[log_len], REC_RING_SIZE - log_len);
+    }
+    CHECK_FALSE(recorder.overflowed());
+
+    uint8_t recorded[REC_TRACE_MAX];
+    const uint32_t recorded_len = trace_len;
+    for( uint32_t i = 0; i < trace_len; ++i ) recorded[i] = trace[i];
+
+    /* Replay into a fresh scheduler with the same table and modes */
+    Scheduler replayed;
+    Scheduler::Extension replayedExt;
+    Recorder player;
+    (void)replayed.init(taskTable, REC_NUM_TASKS, SYSTICK_INTERVAL_10mS);
+    (void)replayed.extend(&replayedExt);
+    CHECK_TRUE(replayed.initModes(modes, 2));
+    CHECK_TRUE(player.initReplay(log, log_len));
+    CHECK_TRUE(replayed.attachRecorder(&player));
+
+    trace_len = 0;
+    CHECK_EQUAL(0, replay(replayed, player));
+
+    CHECK_EQUAL(recorded_len, trace_len);
+    for( uint32_t i = 0; i < trace_len; ++i )
+    {
+        CHECK_EQUAL(recorded[i], trace[i]);
+    }
+    CHECK_EQUAL(myScheduler.currentMode(), replayed.currentMode());
+}
+
+/**
+ * @brief Child releases follow the log, including those decided by a tick
+ *        that arrived while the parent's tasks ran
+ * 
+ */
+TEST(Recorder_TestGroup, replay_NestedChild)
+{
+    /* fastTask last: its mid-pass tick is only seen by the child release */
+    Scheduler::Task parentTable[REC_NUM_TASKS] = {
+        {slowTask, 3},
+        {eventTask, Scheduler::EVENT_DRIVEN},
+        {fastTask, 1}
+    };
+    Scheduler::Task childTable[TEST_REC_ONE_TASK] = {
+        {eventTask, 1}
+    };
+    Scheduler child;
+    Scheduler::Extension childExt;
+
+    (void)myScheduler.init(parentTable, REC_NUM_TASKS, SYSTICK_INTERVAL_10mS);
+    (void)child.init(childTable, TEST_REC_ONE_TASK, 2 * SYSTICK_INTERVAL_10mS);
+    (void)child.extend(&childExt);
+    CHECK_TRUE(myScheduler.attachChild(&child, 2));
+    CHECK_TRUE(recorder.init(ring, REC_RING_SIZE));
+    CHECK_TRUE(myScheduler.attachRecorder(&recorder));
+    recordSession();
+    CHECK_FALSE(recorder.overflowed());
+
+    uint8_t recorded[REC_TRACE_MAX];
+    const uint32_t recorded_len = trace_len;
+    for( uint32_t i = 0; i < trace_len; ++i ) recorded[i] = trace[i];
+
+    /* Replay into a fresh parent and child with the same tables */
+    Scheduler::Task replayedTable[REC_NUM_TASKS] = {
+        {slowTask, 3},
+        {eventTask, Scheduler::EVENT_DRIVEN},
+        {fastTask, 1}
+    };
+    Scheduler::Task replayedChildTable[TEST_REC_ONE_TASK] = {
+        {eventTask, 1}
+    };
+    Scheduler replayed;
+    Scheduler replayedChild;
+    Scheduler::Extension replayedExt;
+    Scheduler::Extension replayedChildExt;
+    Recorder player;
+    (void)replayed.init(replayedTable, REC_NUM_TASKS, SYSTICK_INTERVAL_10mS);
+    (void)replayed.extend(&replayedExt);
+    (void)replayedChild.init(replayedChildTable, TEST_REC_ONE_TASK, 2 * SYSTICK_INTERVAL_10mS);
+    (void)replayedChild.extend(&replayedChildExt);
+    CHECK_TRUE(replayed.attachChild(&replayedChild, 2));
+    CHECK_TRUE(player.initReplay(log, log_len));
+    CHECK_TRUE(replayed.attachRecorder(&player));
+
+    trace_len = 0;
+    CHECK_EQUAL(0, replay(replayed, player));
+
+    CHECK_EQUAL(recorded_len, trace_len);
+    for( uint32_t i = 0; i < trace_len; ++i )
+    {
+        CHECK_EQUAL(recorded[i], trace[i]);
+    }
+
+    /* A child released at another rate is reported */
+    Scheduler other;
+    Scheduler otherChild;
+    Scheduler::Extension otherExt;
+    Scheduler::Extension otherChildExt;
+    (void)other.init(replayedTable, REC_NUM_TASKS, SYSTICK_INTERVAL_10mS);
+    (void)other.extend(&otherExt);
+    (void)otherChild.init(replayedChildTable, TEST_REC_ONE_TASK, 3 * SYSTICK_INTERVAL_10mS);
+    (void)otherChild.extend(&otherChildExt);
+    CHECK_TRUE(other.attachChild(&otherChild, 3));
+    CHECK_TRUE(player.initReplay(log, log_len));
+    CHECK_TRUE(other.attachRecorder(&player));
+    CHECK(replay(other, player) > 0);
+}
+
+/**
+ * @brief The governor throttles on the logged end-of-pass read, so a
+ *        replay stretches and restores the same intervals at the same passes
+ * 
+ */
+TEST(Recorder_TestGroup, replay_Governed)
+{
+    Scheduler::Task govTable[2] = {
+        {slowTask, 1},
+        {burstTask, 1}
+    };
+    const Scheduler::Limits limits[2] = {
+        {0, 0, 0},
+        {1, 0, 16}
+    };
+    Scheduler::Governor governor;
+    uint32_t effective[2];
+
+    (void)myScheduler.init(govTable, 2, SYSTICK_INTERVAL_10mS);
+    CHECK_TRUE(governor.init(limits, effective, 2, 0, 1, 1));
+    CHECK_TRUE(myScheduler.attachGovernor(&governor));
+    CHECK_TRUE(recorder.init(ring, REC_RING_SIZE));
+    CHECK_TRUE(myScheduler.attachRecorder(&recorder));
+
+    isr_target = &myScheduler;
+    for( uint32_t i = 0; i < 200; ++i )
+    {
+        if( i % 2 == 0 ) (void)myScheduler.tick();
+        myScheduler.run();
+        log_len += recorder.drain(&log[log_len], REC_RING_SIZE - log_len);
+    }
+    isr_target = NULL;
+    CHECK_FALSE(recorder.overflowed());
+
+    uint8_t recorded[REC_TRACE_MAX];
+    const uint32_t recorded_len = trace_len;
+    for( uint32_t i = 0; i < trace_len; ++i ) recorded[i] = trace[i];
+
+    /* Replay into a fresh scheduler with the same table and governor */
+    Scheduler::Task replayedTable[2] = {
+        {slowTask, 1},
+        {burstTask, 1}
+    };
+    Scheduler::Governor replayedGovernor;
+    uint32_t replayedEffective[2];
+    Scheduler replayed;
+    Scheduler::Extension replayedExt;
+    Recorder player;
+    (void)replayed.init(replayedTable, 2, SYSTICK_INTERVAL_10mS);
+    (void)replayed.extend(&replayedExt);
+    CHECK_TRUE(replayedGovernor.init(limits, replayedEffective, 2, 0, 1, 1));
+    CHECK_TRUE(replayed.attachGovernor(&replayedGovernor));
+    CHECK_TRUE(player.initReplay(log, log_len));
+    CHECK_TRUE(replayed.attachRecorder(&player));
+
+    trace_len = 0;
+    CHECK_EQUAL(0, replay(replayed, player));
+
+    CHECK_EQUAL(recorded_len, trace_len);
+    for( uint32_t i = 0; i < trace_len; ++i )
+    {
+        CHECK_EQUAL(recorded[i], trace[i]);
+    }
+    CHECK_EQUAL(myScheduler.effectiveInterval(1), replayed.effectiveInterval(1));
+}
+
+/**
+ * @brief The log holds no task phases, so attaching after a pass is refused
+ * 
+ */
+TEST(Recorder_TestGroup, attach_MidRunRejected)
+{
+    CHECK_TRUE(recorder.init(ring, REC_RING_SIZE));
+
+    for( uint32_t i = 0; i < 5; ++i )
+    {
+        (void)myScheduler.tick();
+        myScheduler.run();
+    }
+    CHECK_FALSE(myScheduler.attachRecorder(&recorder));
+    CHECK_EQUAL(0, recorder.drain(log, REC_RING_SIZE));
+
+    /* A fresh init() allows recording again */
+    (void)myScheduler.init(taskTable, REC_NUM_TASKS, SYSTICK_INTERVAL_10mS);
+    CHECK_TRUE(myScheduler.attachRecorder(&recorder));
+}
+
+/**
+ * @brief A 64-bit start tick survives the log
+ * 
+ */
+TEST(Recorder_TestGroup, replay_WideStartTick)
+{
+    const uint64_t start = ( (uint64_t)1 << 40 ) + 3;
+    BasicScheduler<uint64_t>::Task wideTable[TEST_REC_ONE_TASK] = {
+        {slowTask, 1}
+    };
+    BasicScheduler<uint64_t> wide;
+    BasicScheduler<uint64_t>::Extension wideExt;
+    Recorder player;
+
+    CHECK_TRUE(recorder.init(ring, REC_RING_SIZE));
+    recorder.begin(start);
+    log_len = recorder.drain(log, REC_RING_SIZE);
+
+    (void)wide.init(wideTable, TEST_REC_ONE_TASK, SYSTICK_INTERVAL_10mS);
+    (void)wide.extend(&wideExt);
+    CHECK_TRUE(player.initReplay(log, log_len));
+    CHECK_TRUE(wide.attachRecorder(&player));
+    CHECK(start == wide.getTickCount());
+}
@@ -0,0 +1,204 @@
+/**
+ * @file test_SchedulerStats.cpp
+ * @author Niel Cansino (nielcansino@gmail.com)
+ * @brief Test stub for the live scheduler statistics
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ */
+
+#include "CppUTest/TestHarness.h"
+#include "Scheduler.hpp"
+#include "SchedulerStats.hpp"
+
+#define STATS_NUM_TASKS (2)
+#define SYSTICK_INTERVAL_10mS (10000U) /* duration of a systick, in us */
+#define TASK_A_COST_US (3000U)
+#define TASK_B_COST_US (1000U)
+
+/**
+ * Fake microsecond clock, advanced by the tasks to simulate their cost
+ */
+static uint32_t fake_clock_us = 0;
+
+static uint32_t fakeClock(void)
+{
+    return fake_clock_us;
+}
+
+static void costlyTaskA(void)
+{
+    fake_clock_us += TASK_A_COST_US;
+}
+
+static void costlyTaskB(void)
+{
+    fake_clock_us += TASK_B_COST_US;
+}
+
+/**
+ * @brief Test group for SchedulerStats
+ * 
+ */
+TEST_GROUP(SchedulerStats_TestGroup)
+{
+    /* Build sample task table */
+    Scheduler::Task taskTable[STATS_NUM_TASKS] = {
+        {costlyTaskA, 1},   /*!< 1: 30% of every tick */
+        {costlyTaskB, 2}    /*!< 2: 10% of every other tick */
+    };
+
+    SchedulerStats::TaskLoad loads[STATS_NUM_TASKS];
+    SchedulerStats stats;
+    Scheduler myScheduler;
+    Scheduler::Extension ext;
+
+    void setup()
+    {
+        fake_clock_us = 0;
+        (void)myScheduler.init(taskTable, STATS_NUM_TASKS, SYSTICK_INTERVAL_10mS);
+        (void)myScheduler.extend(&ext);
+    }
+
+    /* Runs [ticks] ticks, one pass per tick, idling until the tick boundary */
+    void runTicks(const uint32_t ticks)
+    {
+        for( uint32_t i = 0; i < ticks; ++i )
+        {
+            const uint32_t tick_start = fake_clock_us;
+            myScheduler.run();
+            fake_clock_us = tick_start + SYSTICK_INTERVAL_10mS;
+            (void)myScheduler.tick();
+        }
+    }
+};
+
+/**
+ * @brief Edge conditions on init and attach
+ * 
+ */
+TEST(SchedulerStats_TestGroup, init_EdgeConditions)
+{
+    CHECK_FALSE(stats.init(NULL, STATS_NUM_TASKS, fakeClock));
+    CHECK_FALSE(stats.init(loads, STATS_NUM_TASKS, NULL));
+    CHECK_TRUE(stats.init(loads, STATS_NUM_TASKS, fakeClock));
+
+    CHECK_FALSE(myScheduler.attachStats(NULL));
+    CHECK_TRUE(myScheduler.attachStats(&stats));
+
+    /* Before the first tick: nominal figures, nothing measured */
+    SchedulerStats::Sample sample;
+    CHECK_TRUE(stats.read(sample, NULL, 0));
+    CHECK_EQUAL(SYSTICK_INTERVAL_10mS, sample.nominal_tick_us);
+    CHECK_EQUAL(SYSTICK_INTERVAL_10mS, sample.tick_period_us);
+    CHECK_EQUAL(SchedulerStats::LOAD_ONE, sample.idle);
+    CHECK_EQUAL(0, sample.ticks);
+}
+
+/**
+ * @brief Decayed loads, idle fraction, tick period and worst tick load
+ *        converge to the simulated figures
+ * 
+ */
+TEST(SchedulerStats_TestGroup, run_Converges)
+{
+    CHECK_TRUE(stats.init(loads, STATS_NUM_TASKS, fakeClock));
+    CHECK_TRUE(myScheduler.attachStats(&stats));
+
+    runTicks(200);
+
+    SchedulerStats::Sample sample;
+    uint16_t task_loads[STATS_NUM_TASKS];
+    CHECK_TRUE(stats.read(sample, task_loads, STATS_NUM_TASKS));
+
+    const uint32_t one = SchedulerStats::LOAD_ONE;
+
+    /* Exact figures */
+    CHECK_EQUAL(199, sample.ticks);
+    CHECK_EQUAL(199, sample.passes);
+    CHECK_EQUAL(SYSTICK_INTERVAL_10mS, sample.tick_period_us);
+    CHECK_EQUAL(one * ( TASK_A_COST_US + TASK_B_COST_US ) / SYSTICK_INTERVAL_10mS, sample.worst_tick_load);
+
+    /* Decayed figures, within rounding and the ripple of the every-other-tick task */
+    CHECK(task_loads[0] > one * 29 / 100 && task_loads[0] <= one * 30 / 100);
+    CHECK(task_loads[1] > one * 3 / 100 && task_loads[1] < one * 7 / 100);
+    CHECK(sample.idle > one * 62 / 100 && sample.idle < one * 68 / 100);
+}
+
+/**
+ * @brief A slow tick source shows up in the measured tick period
+ * 
+ */
+TEST(SchedulerStats_TestGroup, run_TickPeriodDrift)
+{
+    CHECK_TRUE(stats.init(loads, STATS_NUM_TASKS, fakeClock));
+    CHECK_TRUE(myScheduler.attachStats(&stats));
+
+    /* Tick arrives every 12.5 ms instead of 10 ms */
+    for( uint32_t i = 0; i < 200; ++i )
+    {
+        const uint32_t tick_start = fake_clock_us;
+        myScheduler.run();
+        fake_clock_us = tick_start + 12500U;
+        (void)myScheduler.tick();
+    }
+
+    SchedulerStats::Sample sample;
+    CHECK_TRUE(stats.read(sample, NULL, 0));
+    CHECK(sample.tick_period_us >= 12400U && sample.tick_period_us <= 12500U);
+    CHECK_EQUAL(SYSTICK_INTERVAL_10mS, sample.nominal_tick_us);
+}
+
+/**
+ * @brief A nested scheduler is charged as one more task of the parent
+ * 
+ */
+TEST(SchedulerStats_TestGroup, run_ChildRollUp)
+{
+    Scheduler::Task childTable[1] = {
+        {costlyTaskB, 1}    /*!< 1: every child tick, 10% of every other parent tick */
+    };
+    Scheduler child;
+    Scheduler::Extension childExt;
+    SchedulerStats::TaskLoad all_loads[STATS_NUM_TASKS + 1];
+
+    CHECK_TRUE(child.init(childTable, 1, 2 * SYSTICK_INTERVAL_10mS));
+    CHECK_TRUE(child.extend(&childExt));
+    CHECK_TRUE(myScheduler.attachChild(&child, 2));
+    CHECK_TRUE(stats.init(all_loads, STATS_NUM_TASKS + 1, fakeClock));
+    CHECK_TRUE(myScheduler.attachStats(&stats));
+
+    runTicks(200);
+
+    SchedulerStats::Sample sample;
+    uint16_t task_loads[STATS_NUM_TASKS + 1];
+    CHECK_TRUE(stats.read(sample, task_loads, STATS_NUM_TASKS + 1));
+
+    const uint32_t one = SchedulerStats::LOAD_ONE;
+
+    /* The child's share shows in its own slot and in the parent's idle figure */
+    CHECK(task_loads[0] > one * 29 / 100 && task_loads[0] <= one * 30 / 100);
+    CHECK(task_loads[STATS_NUM_TASKS] > one * 3 / 100 && task_loads[STATS_NUM_TASKS] < one * 7 / 100);
+    CHECK(sample.idle > one * 57 / 100 && sample.idle < one * 63 / 100);
+    CHECK_EQUAL(one * ( TASK_A_COST_US + 2 * TASK_B_COST_US ) / SYSTICK_INTERVAL_10mS, sample.worst_tick_load);
+}